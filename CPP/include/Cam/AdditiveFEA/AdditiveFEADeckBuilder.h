@@ -57,6 +57,7 @@ public:
     core::Ptr<AdditiveFEAConvection> createConvection();
 
     /// Append an input card to the deck
+    /// When an output file is open, the card is written to the file immediately and is not kept in memory
     void append(const core::Ptr<AdditiveFEADeckBuilderCard>& card);
 
     /// Creates a generic key value card
@@ -143,6 +144,63 @@ public:
     /// Gets the list of cards that makes up the deck.
     std::vector<core::Ptr<AdditiveFEADeckBuilderCard>> cards() const;
 
+    /// Starts writing the deck to a file.  From this call on, every appended card is serialised to the file as soon as it is
+    /// appended instead of being accumulated by the deck builder, so the memory used does not grow with the size of the deck.
+    /// Cards appended before this call are written to the file first.  cards only returns the cards that were not written yet.
+    /// filePath : The full path of the deck file.  An existing file is overwritten
+    /// Returns true if the file could be opened for writing
+    bool openOutputFile(const std::string& filePath);
+
+    /// Flushes and closes the output file opened with openOutputFile.  Cards appended afterwards are accumulated in memory again
+    /// Returns true if all cards were written successfully
+    bool closeOutputFile();
+
+    /// Returns true while an output file opened with openOutputFile is open
+    bool isWritingToFile() const;
+
+    /// Returns the number of bytes written to the output file since it was opened
+    size_t bytesWritten() const;
+
+    /// Appends a generic enumerated card with no arguments without creating a card object.  See createVoidCard for the cards that can be appended.
+    /// When an output file is open, the card is written to the file immediately and is not kept in memory
+    /// card : The type of card to append, e.g. BinaryOutputCard
+    /// Returns true if the card was appended
+    bool appendVoidCard(AdditiveFEACard card);
+
+    /// Appends a generic enumerated card with a single integer argument without creating a card object.  See createIntCard for the cards that can be appended.
+    /// When an output file is open, the card is written to the file immediately and is not kept in memory
+    /// card : The type of card to append, e.g. LayersPerElementCard
+    /// value : The int value argument of the card
+    /// Returns true if the card was appended
+    bool appendIntCard(AdditiveFEACard card, int value);
+
+    /// Appends a generic enumerated card with a single double argument without creating a card object.  See createDoubleCard for the cards that can be appended.
+    /// When an output file is open, the card is written to the file immediately and is not kept in memory
+    /// card : The type of card to append, e.g. STLToleranceCard
+    /// value : The double value argument of the card
+    /// Returns true if the card was appended
+    bool appendDoubleCard(AdditiveFEACard card, double value);
+
+    /// Appends a generic enumerated card with a single string argument without creating a card object.  See createStringCard for the cards that can be appended.
+    /// When an output file is open, the card is written to the file immediately and is not kept in memory
+    /// card : The type of card to append, e.g. TitleCard
+    /// value : The string value argument of the card
+    /// Returns true if the card was appended
+    bool appendStringCard(AdditiveFEACard card, const std::string& value);
+
+    /// Appends a generic enumerated card with an array of string arguments without creating a card object.  See createStringArrayCard for the cards that can be appended.
+    /// When an output file is open, the card is written to the file immediately and is not kept in memory
+    /// card : The type of card to append, e.g. STLsCard
+    /// value : The string-array value argument of the card
+    /// Returns true if the card was appended
+    bool appendStringArrayCard(AdditiveFEACard card, const std::vector<std::string>& value);
+
+    /// Appends the *STLM card of an STL map without creating a card object.
+    /// When an output file is open, the rows of the map are written to the file directly from the map
+    /// map : An AdditiveFEASTLMap object to define the mapping of configuration, PRM, material, and volume fraction for each body
+    /// Returns true if the card was appended
+    bool appendSTLMap(const core::Ptr<AdditiveFEASTLMap>& map);
+
     ADSK_CAM_ADDITIVEFEADECKBUILDER_API static const char* classType();
     ADSK_CAM_ADDITIVEFEADECKBUILDER_API const char* objectType() const override;
     ADSK_CAM_ADDITIVEFEADECKBUILDER_API void* queryInterface(const char* id) const override;
@@ -167,6 +225,16 @@ private:
     virtual AdditiveFEADeckBuilderCard* createConvectionCard_raw(AdditiveFEAConvection* convection) = 0;
     virtual AdditiveFEADeckBuilderCard* createBuildPlateXYExtensionCard_raw(double left, double right, double front, double back) = 0;
     virtual AdditiveFEADeckBuilderCard** cards_raw(size_t& return_size) const = 0;
+    virtual bool openOutputFile_raw(const char* filePath) = 0;
+    virtual bool closeOutputFile_raw() = 0;
+    virtual bool isWritingToFile_raw() const = 0;
+    virtual size_t bytesWritten_raw() const = 0;
+    virtual bool appendVoidCard_raw(AdditiveFEACard card) = 0;
+    virtual bool appendIntCard_raw(AdditiveFEACard card, int value) = 0;
+    virtual bool appendDoubleCard_raw(AdditiveFEACard card, double value) = 0;
+    virtual bool appendStringCard_raw(AdditiveFEACard card, const char* value) = 0;
+    virtual bool appendStringArrayCard_raw(AdditiveFEACard card, const char** value, size_t value_size) = 0;
+    virtual bool appendSTLMap_raw(AdditiveFEASTLMap* map) = 0;
 };
 
 // Inline wrappers
@@ -280,6 +348,73 @@ inline std::vector<core::Ptr<AdditiveFEADeckBuilderCard>> AdditiveFEADeckBuilder
     }
     return res;
 }
+
+inline bool AdditiveFEADeckBuilder::openOutputFile(const std::string& filePath)
+{
+    bool res = openOutputFile_raw(filePath.c_str());
+    return res;
+}
+
+inline bool AdditiveFEADeckBuilder::closeOutputFile()
+{
+    bool res = closeOutputFile_raw();
+    return res;
+}
+
+inline bool AdditiveFEADeckBuilder::isWritingToFile() const
+{
+    bool res = isWritingToFile_raw();
+    return res;
+}
+
+inline size_t AdditiveFEADeckBuilder::bytesWritten() const
+{
+    size_t res = bytesWritten_raw();
+    return res;
+}
+
+inline bool AdditiveFEADeckBuilder::appendVoidCard(AdditiveFEACard card)
+{
+    bool res = appendVoidCard_raw(card);
+    return res;
+}
+
+inline bool AdditiveFEADeckBuilder::appendIntCard(AdditiveFEACard card, int value)
+{
+    bool res = appendIntCard_raw(card, value);
+    return res;
+}
+
+inline bool AdditiveFEADeckBuilder::appendDoubleCard(AdditiveFEACard card, double value)
+{
+    bool res = appendDoubleCard_raw(card, value);
+    return res;
+}
+
+inline bool AdditiveFEADeckBuilder::appendStringCard(AdditiveFEACard card, const std::string& value)
+{
+    bool res = appendStringCard_raw(card, value.c_str());
+    return res;
+}
+
+inline bool AdditiveFEADeckBuilder::appendStringArrayCard(AdditiveFEACard card, const std::vector<std::string>& value)
+{
+    const char** value_ = value.empty() ? nullptr : (new const char*[value.size()]);
+    for(size_t i = 0; i < value.size(); ++i)
+    {
+        value_[i] = value[i].c_str();
+    }
+
+    bool res = appendStringArrayCard_raw(card, value_, value.size());
+    delete[] value_;
+    return res;
+}
+
+inline bool AdditiveFEADeckBuilder::appendSTLMap(const core::Ptr<AdditiveFEASTLMap>& map)
+{
+    bool res = appendSTLMap_raw(map.get());
+    return res;
+}
 }// namespace cam
 }// namespace adsk
 
@@ -11,6 +11,7 @@
 #pragma once
 #include "../../Core/Base.h"
 #include "../CamTypeDefs.h"
+#include <vector>
 
 // THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
 // THIS HEADER FILE WILL BE GENERATED FROM NIDL.
@@ -43,6 +44,18 @@ public:
     /// volumeFraction : Set a volume fraction for the geometry in the range [0, 1]
     void append(AdditiveFEASTLConfiguration configuration, int prmId, int materialId, double volumeFraction);
 
+    /// Append rows of *STLM data for many geometries to the STL map in a single call. The arrays are parallel:
+    /// row i is made of the i-th entry of each array, and rows are appended in array order after any existing rows.
+    /// configurations : Specifies each geometry as either part, support, build plate, or ghost part.  The values are obtained from the AdditiveFEASTLConfiguration enum and passed as integers
+    /// prmIds : Maps a set of processing parameters from a PRM file to each geometry
+    /// materialIds : Maps a set of material properties to each geometry
+    /// volumeFractions : Set a volume fraction for each geometry in the range [0, 1]
+    /// Returns true if all rows were appended.  No row is appended if the arrays do not have the same size or a value is out of range
+    bool appendRows(const std::vector<int>& configurations, const std::vector<int>& prmIds, const std::vector<int>& materialIds, const std::vector<double>& volumeFractions);
+
+    /// Returns the number of rows in the STL map
+    size_t count() const;
+
     ADSK_CAM_ADDITIVEFEASTLMAP_API static const char* classType();
     ADSK_CAM_ADDITIVEFEASTLMAP_API const char* objectType() const override;
     ADSK_CAM_ADDITIVEFEASTLMAP_API void* queryInterface(const char* id) const override;
@@ -52,6 +65,8 @@ private:
 
     // Raw interface
     virtual void append_raw(AdditiveFEASTLConfiguration configuration, int prmId, int materialId, double volumeFraction) = 0;
+    virtual bool appendRows_raw(const int* configurations, size_t configurations_size, const int* prmIds, size_t prmIds_size, const int* materialIds, size_t materialIds_size, const double* volumeFractions, size_t volumeFractions_size) = 0;
+    virtual size_t count_raw() const = 0;
 };
 
 // Inline wrappers
@@ -60,6 +75,18 @@ inline void AdditiveFEASTLMap::append(AdditiveFEASTLConfiguration configuration,
 {
     append_raw(configuration, prmId, materialId, volumeFraction);
 }
+
+inline bool AdditiveFEASTLMap::appendRows(const std::vector<int>& configurations, const std::vector<int>& prmIds, const std::vector<int>& materialIds, const std::vector<double>& volumeFractions)
+{
+    bool res = appendRows_raw(configurations.empty() ? nullptr : &configurations[0], configurations.size(), prmIds.empty() ? nullptr : &prmIds[0], prmIds.size(), materialIds.empty() ? nullptr : &materialIds[0], materialIds.size(), volumeFractions.empty() ? nullptr : &volumeFractions[0], volumeFractions.size());
+    return res;
+}
+
+inline size_t AdditiveFEASTLMap::count() const
+{
+    size_t res = count_raw();
+    return res;
+}
 }// namespace cam
 }// namespace adsk
 
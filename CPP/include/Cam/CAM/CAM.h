@@ -29,12 +29,15 @@
 #endif
 
 namespace adsk { namespace cam {
+    class CAMBatchedChangeEvent;
     class CAMExportManager;
     class CAMImportManager;
     class CAMInspectionResults;
     class DocumentStockMaterialLibrary;
     class DocumentToolLibrary;
     class GenerateToolpathFuture;
+    class KinematicMachiningTime;
+    class KinematicMachiningTimeInput;
     class Machine;
     class MachiningTime;
     class ManufacturingModels;
@@ -44,6 +47,10 @@ namespace adsk { namespace cam {
     class SetupEvent;
     class SetupGroups;
     class Setups;
+    class StockSimulationInput;
+    class StockSimulationResult;
+    class ToolpathGenerationInput;
+    class ToolpathInvalidationResults;
 }}
 namespace adsk { namespace core {
     class ObjectCollection;
@@ -271,6 +278,127 @@ public:
     /// A Setup Group is a collection of Setup objects that are intended to be machined at the same time.
     core::Ptr<SetupGroups> setupGroups() const;
 
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Creates a new ToolpathGenerationInput object for the specified objects to be used with the generateToolpathWithInput method.
+    /// operations : An Operation, Setup, Folder, or Pattern object. You can also use an ObjectCollection
+    /// to specify multiple objects of any of the supported types.
+    /// Returns the newly created ToolpathGenerationInput object or null if the creation failed.
+    core::Ptr<ToolpathGenerationInput> createToolpathGenerationInput(const core::Ptr<core::Base>& operations);
+
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Generates or regenerates the operations of the input, including those nested in sub-folders or patterns,
+    /// using the priorities and the maximum concurrency defined by the input.
+    /// Use the operationGenerated event of the returned future to get notified as soon as each operation is generated.
+    /// input : The ToolpathGenerationInput object that defines the operations and how they are scheduled.
+    /// Return GenerateToolpathFuture that includes the status of the operation generation.
+    core::Ptr<GenerateToolpathFuture> generateToolpathWithInput(const core::Ptr<ToolpathGenerationInput>& input);
+
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Compares the entity tokens of the faces and the revision ids of the bodies referenced by the specified operations,
+    /// including those nested in sub-folders or patterns, with the ones recorded when the operations were generated.
+    /// This is a dry run: no operation is invalidated.
+    /// operations : An Operation, Setup, Folder, or Pattern object. You can also use an ObjectCollection
+    /// to specify multiple objects of any of the supported types.
+    /// Returns a collection with one result for each checked operation that reports whether it would be regenerated and why.
+    core::Ptr<ToolpathInvalidationResults> analyzeToolpathInvalidation(const core::Ptr<core::Base>& operations);
+
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Invalidates only those of the specified operations, including those nested in sub-folders or patterns, whose referenced
+    /// faces, bodies or stock have actually changed, together with the operations depending on them.
+    /// Unlike checkValidity, operations referencing only unchanged geometry stay valid, so a subsequent call of
+    /// generateAllToolpaths with skipValid set to true only regenerates the affected operations.
+    /// operations : An Operation, Setup, Folder, or Pattern object. You can also use an ObjectCollection
+    /// to specify multiple objects of any of the supported types.
+    /// Returns a collection with one result for each checked operation that reports whether it was invalidated and why.
+    core::Ptr<ToolpathInvalidationResults> invalidateChangedToolpaths(const core::Ptr<core::Base>& operations);
+
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Creates a new KinematicMachiningTimeInput object for the specified objects to be used with the getKinematicMachiningTime method.
+    /// operations : An Operation, Setup, Folder, or Pattern object. You can also use an ObjectCollection
+    /// to specify multiple objects of any of the supported types.
+    /// Returns the newly created KinematicMachiningTimeInput object or null if the creation failed.
+    core::Ptr<KinematicMachiningTimeInput> createKinematicMachiningTimeInput(const core::Ptr<core::Base>& operations);
+
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Get the machining time for the operations of the input, taking the dynamics of the machine axes and the controller into account.
+    /// The operations have to be generated. Operations are estimated in parallel.
+    /// input : The KinematicMachiningTimeInput object that defines the operations and the options of the estimate.
+    /// Returns a KinematicMachiningTime object that has properties holding the calculation results.
+    core::Ptr<KinematicMachiningTime> getKinematicMachiningTime(const core::Ptr<KinematicMachiningTimeInput>& input);
+
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Creates a new StockSimulationInput object for the specified objects to be used with the simulateStockRemoval method.
+    /// operations : An Operation, Setup, Folder, or Pattern object. You can also use an ObjectCollection
+    /// to specify multiple objects of any of the supported types. All operations must belong to the same setup.
+    /// Returns the newly created StockSimulationInput object or null if the creation failed.
+    core::Ptr<StockSimulationInput> createStockSimulationInput(const core::Ptr<core::Base>& operations);
+
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Simulates the material removal of the operations of the input without displaying the simulation.
+    /// The operations have to be generated. The tool sweeps are applied to the stock in parallel.
+    /// input : The StockSimulationInput object that defines the operations and the options of the simulation.
+    /// Returns a StockSimulationResult object holding the deviations and the collisions, or null if the simulation failed.
+    core::Ptr<StockSimulationResult> simulateStockRemoval(const core::Ptr<StockSimulationInput>& input);
+
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// The batchedChanged event fires with the coalesced list of the operation changes raised by CAMEventManager.operationBaseChanged
+    /// and the setup changes raised by setupChanged, for handlers that do not need to be notified of every single change,
+    /// for instance while a template is applied or parameters are swept. Changes are collected only while a handler is added
+    /// to the event, and the operationBaseChanged and setupChanged events still fire for their own handlers.
+    core::Ptr<CAMBatchedChangeEvent> batchedChanged() const;
+
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Gets and sets the time in seconds between two deliveries of the batchedChanged event. Changes raised during the interval
+    /// are delivered together at its end. 0 delivers the changes only when the command or transaction that raised them ends.
+    /// Defaults to 0.
+    double batchedChangeInterval() const;
+    bool batchedChangeInterval(double value);
+
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Returns the number of operationBaseChanged and setupChanged events raised since the document was opened.
+    size_t changeEventsRaisedCount() const;
+
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Returns the number of coalesced changes delivered by the batchedChanged event since the document was opened.
+    /// Comparing it with changeEventsRaisedCount shows how many notifications were saved by batching.
+    size_t changeEventsDeliveredCount() const;
+
     ADSK_CAM_CAM_API static const char* classType();
     ADSK_CAM_CAM_API const char* objectType() const override;
     ADSK_CAM_CAM_API void* queryInterface(const char* id) const override;
@@ -318,6 +446,19 @@ private:
     virtual DocumentStockMaterialLibrary* documentStockMaterialLibrary_raw() const = 0;
     virtual CAMImportManager* importManager_raw() const = 0;
     virtual SetupGroups* setupGroups_raw() const = 0;
+    virtual ToolpathGenerationInput* createToolpathGenerationInput_raw(core::Base* operations) = 0;
+    virtual GenerateToolpathFuture* generateToolpathWithInput_raw(ToolpathGenerationInput* input) = 0;
+    virtual ToolpathInvalidationResults* analyzeToolpathInvalidation_raw(core::Base* operations) = 0;
+    virtual ToolpathInvalidationResults* invalidateChangedToolpaths_raw(core::Base* operations) = 0;
+    virtual KinematicMachiningTimeInput* createKinematicMachiningTimeInput_raw(core::Base* operations) = 0;
+    virtual KinematicMachiningTime* getKinematicMachiningTime_raw(KinematicMachiningTimeInput* input) = 0;
+    virtual StockSimulationInput* createStockSimulationInput_raw(core::Base* operations) = 0;
+    virtual StockSimulationResult* simulateStockRemoval_raw(StockSimulationInput* input) = 0;
+    virtual CAMBatchedChangeEvent* batchedChanged_raw() const = 0;
+    virtual double batchedChangeInterval_raw() const = 0;
+    virtual bool batchedChangeInterval_raw(double value) = 0;
+    virtual size_t changeEventsRaisedCount_raw() const = 0;
+    virtual size_t changeEventsDeliveredCount_raw() const = 0;
 };
 
 // Inline wrappers
@@ -589,6 +730,83 @@ inline core::Ptr<SetupGroups> CAM::setupGroups() const
     core::Ptr<SetupGroups> res = setupGroups_raw();
     return res;
 }
+
+inline core::Ptr<ToolpathGenerationInput> CAM::createToolpathGenerationInput(const core::Ptr<core::Base>& operations)
+{
+    core::Ptr<ToolpathGenerationInput> res = createToolpathGenerationInput_raw(operations.get());
+    return res;
+}
+
+inline core::Ptr<GenerateToolpathFuture> CAM::generateToolpathWithInput(const core::Ptr<ToolpathGenerationInput>& input)
+{
+    core::Ptr<GenerateToolpathFuture> res = generateToolpathWithInput_raw(input.get());
+    return res;
+}
+
+inline core::Ptr<ToolpathInvalidationResults> CAM::analyzeToolpathInvalidation(const core::Ptr<core::Base>& operations)
+{
+    core::Ptr<ToolpathInvalidationResults> res = analyzeToolpathInvalidation_raw(operations.get());
+    return res;
+}
+
+inline core::Ptr<ToolpathInvalidationResults> CAM::invalidateChangedToolpaths(const core::Ptr<core::Base>& operations)
+{
+    core::Ptr<ToolpathInvalidationResults> res = invalidateChangedToolpaths_raw(operations.get());
+    return res;
+}
+
+inline core::Ptr<KinematicMachiningTimeInput> CAM::createKinematicMachiningTimeInput(const core::Ptr<core::Base>& operations)
+{
+    core::Ptr<KinematicMachiningTimeInput> res = createKinematicMachiningTimeInput_raw(operations.get());
+    return res;
+}
+
+inline core::Ptr<KinematicMachiningTime> CAM::getKinematicMachiningTime(const core::Ptr<KinematicMachiningTimeInput>& input)
+{
+    core::Ptr<KinematicMachiningTime> res = getKinematicMachiningTime_raw(input.get());
+    return res;
+}
+
+inline core::Ptr<StockSimulationInput> CAM::createStockSimulationInput(const core::Ptr<core::Base>& operations)
+{
+    core::Ptr<StockSimulationInput> res = createStockSimulationInput_raw(operations.get());
+    return res;
+}
+
+inline core::Ptr<StockSimulationResult> CAM::simulateStockRemoval(const core::Ptr<StockSimulationInput>& input)
+{
+    core::Ptr<StockSimulationResult> res = simulateStockRemoval_raw(input.get());
+    return res;
+}
+
+inline core::Ptr<CAMBatchedChangeEvent> CAM::batchedChanged() const
+{
+    core::Ptr<CAMBatchedChangeEvent> res = batchedChanged_raw();
+    return res;
+}
+
+inline double CAM::batchedChangeInterval() const
+{
+    double res = batchedChangeInterval_raw();
+    return res;
+}
+
+inline bool CAM::batchedChangeInterval(double value)
+{
+    return batchedChangeInterval_raw(value);
+}
+
+inline size_t CAM::changeEventsRaisedCount() const
+{
+    size_t res = changeEventsRaisedCount_raw();
+    return res;
+}
+
+inline size_t CAM::changeEventsDeliveredCount() const
+{
+    size_t res = changeEventsDeliveredCount_raw();
+    return res;
+}
 }// namespace cam
 }// namespace adsk
 
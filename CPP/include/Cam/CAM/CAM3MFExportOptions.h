@@ -98,6 +98,45 @@ public:
     int volumetricDataResolution() const;
     bool volumetricDataResolution(int value);
 
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Flag toggling if the 3MF package is written to the file while it is generated. Meshes and volumetric data slices are
+    /// compressed and written as soon as they are available instead of building the whole package in memory first,
+    /// which keeps the memory used by large builds with volumetric data bounded by maxBufferSize.
+    /// The default value is false.
+    bool isStreamed() const;
+    bool isStreamed(bool value);
+
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Integer value representing the maximum amount of memory in megabytes used to buffer parts of the package that are not
+    /// yet written when isStreamed is true. Generating further parts waits while the buffer is full.
+    /// The default value is 256.
+    int maxBufferSize() const;
+    bool maxBufferSize(int value);
+
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Integer value from 0 to 9 representing the deflate compression level of the parts of the package, where 0 stores
+    /// the parts uncompressed and 9 gives the smallest file. The default value is 6.
+    int compressionLevel() const;
+    bool compressionLevel(int value);
+
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Integer value representing the maximum number of parts of the package that are compressed at the same time.
+    /// 0 uses the number of processor cores. The default value is 0.
+    int maxConcurrency() const;
+    bool maxConcurrency(int value);
+
     ADSK_CAM_CAM3MFEXPORTOPTIONS_API static const char* classType();
     ADSK_CAM_CAM3MFEXPORTOPTIONS_API const char* objectType() const override;
     ADSK_CAM_CAM3MFEXPORTOPTIONS_API void* queryInterface(const char* id) const override;
@@ -125,6 +164,14 @@ private:
     virtual bool isVolumetricDataIncluded_raw(bool value) = 0;
     virtual int volumetricDataResolution_raw() const = 0;
     virtual bool volumetricDataResolution_raw(int value) = 0;
+    virtual bool isStreamed_raw() const = 0;
+    virtual bool isStreamed_raw(bool value) = 0;
+    virtual int maxBufferSize_raw() const = 0;
+    virtual bool maxBufferSize_raw(int value) = 0;
+    virtual int compressionLevel_raw() const = 0;
+    virtual bool compressionLevel_raw(int value) = 0;
+    virtual int maxConcurrency_raw() const = 0;
+    virtual bool maxConcurrency_raw(int value) = 0;
 };
 
 // Inline wrappers
@@ -233,6 +280,50 @@ inline bool CAM3MFExportOptions::volumetricDataResolution(int value)
 {
     return volumetricDataResolution_raw(value);
 }
+
+inline bool CAM3MFExportOptions::isStreamed() const
+{
+    bool res = isStreamed_raw();
+    return res;
+}
+
+inline bool CAM3MFExportOptions::isStreamed(bool value)
+{
+    return isStreamed_raw(value);
+}
+
+inline int CAM3MFExportOptions::maxBufferSize() const
+{
+    int res = maxBufferSize_raw();
+    return res;
+}
+
+inline bool CAM3MFExportOptions::maxBufferSize(int value)
+{
+    return maxBufferSize_raw(value);
+}
+
+inline int CAM3MFExportOptions::compressionLevel() const
+{
+    int res = compressionLevel_raw();
+    return res;
+}
+
+inline bool CAM3MFExportOptions::compressionLevel(int value)
+{
+    return compressionLevel_raw(value);
+}
+
+inline int CAM3MFExportOptions::maxConcurrency() const
+{
+    int res = maxConcurrency_raw();
+    return res;
+}
+
+inline bool CAM3MFExportOptions::maxConcurrency(int value)
+{
+    return maxConcurrency_raw(value);
+}
 }// namespace cam
 }// namespace adsk
 
@@ -0,0 +1,232 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "../../Core/Application/Events.h"
+#include "../../Core/Application/EventHandler.h"
+#include "../CamTypeDefs.h"
+#include <vector>
+
+// THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
+// THIS HEADER FILE WILL BE GENERATED FROM NIDL.
+#include "../../Core/OSMacros.h"
+
+#ifdef CAMXINTERFACE_EXPORTS
+# ifdef __COMPILING_CAMBATCHEDCHANGEEVENTS_CPP__
+# define CAMBATCHEDCHANGEEVENTS_API XI_EXPORT
+# else
+# define CAMBATCHEDCHANGEEVENTS_API
+# endif
+#else
+# define CAMBATCHEDCHANGEEVENTS_API XI_IMPORT
+#endif
+
+namespace adsk { namespace cam {
+    class CAMBatchedChangeEventArgs;
+    class CAMBatchedChangeEventHandler;
+    class OperationBase;
+    class Setup;
+}}
+
+namespace adsk { namespace cam {
+
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// A CAMBatchedChangeEvent delivers the operation and setup changes of a period of time as a single list.
+/// It is used by the CAM.batchedChanged event.
+class CAMBatchedChangeEvent : public core::Event {
+public:
+
+    /// Add a handler to be notified when the event occurs.
+    /// handler : The handler object to be called when this event is fired.
+    /// Returns true if the addition of the handler was successful.
+    bool add(CAMBatchedChangeEventHandler* handler);
+
+    /// Removes a handler from the event.
+    /// handler : The handler object to be removed from the event.
+    /// Returns true if removal of the handler was successful.
+    bool remove(CAMBatchedChangeEventHandler* handler);
+
+    CAMBATCHEDCHANGEEVENTS_API static const char* classType();
+    CAMBATCHEDCHANGEEVENTS_API const char* objectType() const override;
+    CAMBATCHEDCHANGEEVENTS_API void* queryInterface(const char* id) const override;
+    CAMBATCHEDCHANGEEVENTS_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual bool add_raw(CAMBatchedChangeEventHandler* handler) = 0;
+    virtual bool remove_raw(CAMBatchedChangeEventHandler* handler) = 0;
+};
+
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// The CAMBatchedChangeEventArgs provides the coalesced operation and setup changes of a batch.
+/// A change is listed once per operation id and change type, or once per setup and change type, however often it was
+/// raised during the batch. Changes are listed in the order they were first raised.
+class CAMBatchedChangeEventArgs : public core::EventArgs {
+public:
+
+    /// Returns the id of the operation of each change. The array has one entry for each coalesced operation change.
+    std::vector<int> operationIds() const;
+
+    /// Returns the operation of each change, or null for an operation that has been deleted since the change. The array has one entry for each coalesced operation change.
+    std::vector<core::Ptr<OperationBase>> operations() const;
+
+    /// Returns the type of each operation change. The values are obtained from the CAMEventChangeType enum and returned as integers. The array has one entry for each coalesced operation change.
+    std::vector<int> operationChangeTypes() const;
+
+    /// Returns the setup of each change. The array has one entry for each coalesced setup change.
+    std::vector<core::Ptr<Setup>> setups() const;
+
+    /// Returns the type of each setup change. The values are obtained from the SetupChangeEventType enum and returned as integers. The array has one entry for each coalesced setup change.
+    std::vector<int> setupChangeTypes() const;
+
+    /// Returns the number of operationBaseChanged and setupChanged events coalesced into this batch.
+    size_t raisedCount() const;
+
+    /// Returns true if the batch is delivered because a command or transaction ended, false if it is delivered because
+    /// batchedChangeInterval elapsed.
+    bool isTransactionEnd() const;
+
+    CAMBATCHEDCHANGEEVENTS_API static const char* classType();
+    CAMBATCHEDCHANGEEVENTS_API const char* objectType() const override;
+    CAMBATCHEDCHANGEEVENTS_API void* queryInterface(const char* id) const override;
+    CAMBATCHEDCHANGEEVENTS_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual int* operationIds_raw(size_t& return_size) const = 0;
+    virtual OperationBase** operations_raw(size_t& return_size) const = 0;
+    virtual int* operationChangeTypes_raw(size_t& return_size) const = 0;
+    virtual Setup** setups_raw(size_t& return_size) const = 0;
+    virtual int* setupChangeTypes_raw(size_t& return_size) const = 0;
+    virtual size_t raisedCount_raw() const = 0;
+    virtual bool isTransactionEnd_raw() const = 0;
+};
+
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// The CAMBatchedChangeEventHandler is a client implemented class that can be added as a handler to a
+/// CAMBatchedChangeEvent.
+class CAMBatchedChangeEventHandler : public core::EventHandler {
+public:
+
+    /// The function called by CAM when the associated event is fired.
+    /// eventArgs : Returns an object that provides access to additional information associated with the event.
+    CAMBATCHEDCHANGEEVENTS_API virtual void notify(const core::Ptr<CAMBatchedChangeEventArgs>& eventArgs) = 0;
+};
+
+// Inline wrappers
+
+inline bool CAMBatchedChangeEvent::add(CAMBatchedChangeEventHandler* handler)
+{
+    bool res = add_raw(handler);
+    return res;
+}
+
+inline bool CAMBatchedChangeEvent::remove(CAMBatchedChangeEventHandler* handler)
+{
+    bool res = remove_raw(handler);
+    return res;
+}
+
+inline std::vector<int> CAMBatchedChangeEventArgs::operationIds() const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= operationIds_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<core::Ptr<OperationBase>> CAMBatchedChangeEventArgs::operations() const
+{
+    std::vector<core::Ptr<OperationBase>> res;
+    size_t s;
+
+    OperationBase** p= operations_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<int> CAMBatchedChangeEventArgs::operationChangeTypes() const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= operationChangeTypes_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<core::Ptr<Setup>> CAMBatchedChangeEventArgs::setups() const
+{
+    std::vector<core::Ptr<Setup>> res;
+    size_t s;
+
+    Setup** p= setups_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<int> CAMBatchedChangeEventArgs::setupChangeTypes() const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= setupChangeTypes_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline size_t CAMBatchedChangeEventArgs::raisedCount() const
+{
+    size_t res = raisedCount_raw();
+    return res;
+}
+
+inline bool CAMBatchedChangeEventArgs::isTransactionEnd() const
+{
+    bool res = isTransactionEnd_raw();
+    return res;
+}
+}// namespace cam
+}// namespace adsk
+
+#undef CAMBATCHEDCHANGEEVENTS_API
\ No newline at end of file
@@ -44,6 +44,7 @@ public:
     bool isGenerationCompleted() const;
 
     /// Returns the progress as a percentage value between 0.0% and 100.0%.
+    /// For 3MF exports with CAM3MFExportOptions.isStreamed set, the progress reflects the bytes written to the file.
     float progress() const;
 
     /// Gets the last encountered error message generated on the export thread.
@@ -54,6 +55,28 @@ public:
     /// Returns an empty string if no warnings have been found.
     std::string warning() const;
 
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Returns the number of bytes written to the export file so far.
+    size_t bytesWritten() const;
+
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Returns the estimated size of the export file in bytes, or 0 if the size cannot be estimated.
+    /// For streamed 3MF exports, progress is bytesWritten relative to this estimate.
+    size_t estimatedSize() const;
+
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Returns the largest amount of memory in bytes used to buffer the export so far.
+    size_t peakMemoryUsage() const;
+
     ADSK_CAM_CAMEXPORTFUTURE_API static const char* classType();
     ADSK_CAM_CAMEXPORTFUTURE_API const char* objectType() const override;
     ADSK_CAM_CAMEXPORTFUTURE_API void* queryInterface(const char* id) const override;
@@ -67,6 +90,9 @@ private:
     virtual float progress_raw() const = 0;
     virtual char* error_raw() const = 0;
     virtual char* warning_raw() const = 0;
+    virtual size_t bytesWritten_raw() const = 0;
+    virtual size_t estimatedSize_raw() const = 0;
+    virtual size_t peakMemoryUsage_raw() const = 0;
 };
 
 // Inline wrappers
@@ -114,6 +140,24 @@ inline std::string CAMExportFuture::warning() const
     }
     return res;
 }
+
+inline size_t CAMExportFuture::bytesWritten() const
+{
+    size_t res = bytesWritten_raw();
+    return res;
+}
+
+inline size_t CAMExportFuture::estimatedSize() const
+{
+    size_t res = estimatedSize_raw();
+    return res;
+}
+
+inline size_t CAMExportFuture::peakMemoryUsage() const
+{
+    size_t res = peakMemoryUsage_raw();
+    return res;
+}
 }// namespace cam
 }// namespace adsk
 
@@ -28,6 +28,7 @@
 
 namespace adsk { namespace cam {
     class InspectionPathResults;
+    class InspectionResultsData;
 }}
 
 namespace adsk { namespace cam {
@@ -44,6 +45,10 @@ public:
     /// return a collection of surface inspection results from a measure or null if none found
     core::Ptr<InspectionPathResults> inspectionPathResults() const;
 
+    /// Access the results of all the surface inspection paths of the measure as flat arrays
+    /// return the results or null if none found
+    core::Ptr<InspectionResultsData> inspectionResultsData() const;
+
     ADSK_CAM_CAMMEASURE_API static const char* classType();
     ADSK_CAM_CAMMEASURE_API const char* objectType() const override;
     ADSK_CAM_CAMMEASURE_API void* queryInterface(const char* id) const override;
@@ -53,6 +58,7 @@ private:
 
     // Raw interface
     virtual InspectionPathResults* inspectionPathResults_raw() const = 0;
+    virtual InspectionResultsData* inspectionResultsData_raw() const = 0;
 };
 
 // Inline wrappers
@@ -62,6 +68,12 @@ inline core::Ptr<InspectionPathResults> CAMMeasure::inspectionPathResults() cons
     core::Ptr<InspectionPathResults> res = inspectionPathResults_raw();
     return res;
 }
+
+inline core::Ptr<InspectionResultsData> CAMMeasure::inspectionResultsData() const
+{
+    core::Ptr<InspectionResultsData> res = inspectionResultsData_raw();
+    return res;
+}
 }// namespace cam
 }// namespace adsk
 
@@ -48,6 +48,15 @@ public:
     AutomaticGenerationModes mode() const;
     bool mode(AutomaticGenerationModes value);
 
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Gets and sets the maximum number of setups whose geometry selections are resolved at the same time when the input is
+    /// used with Setups.createFromCAMTemplate. 0 uses the number of processor cores. Defaults to 0.
+    int maxConcurrency() const;
+    bool maxConcurrency(int value);
+
     ADSK_CAM_CREATEFROMCAMTEMPLATEINPUT_API static const char* classType();
     ADSK_CAM_CREATEFROMCAMTEMPLATEINPUT_API const char* objectType() const override;
     ADSK_CAM_CREATEFROMCAMTEMPLATEINPUT_API void* queryInterface(const char* id) const override;
@@ -61,6 +70,8 @@ private:
     virtual bool camTemplate_raw(CAMTemplate* value) = 0;
     virtual AutomaticGenerationModes mode_raw() const = 0;
     virtual bool mode_raw(AutomaticGenerationModes value) = 0;
+    virtual int maxConcurrency_raw() const = 0;
+    virtual bool maxConcurrency_raw(int value) = 0;
 };
 
 // Inline wrappers
@@ -92,6 +103,17 @@ inline bool CreateFromCAMTemplateInput::mode(AutomaticGenerationModes value)
 {
     return mode_raw(value);
 }
+
+inline int CreateFromCAMTemplateInput::maxConcurrency() const
+{
+    int res = maxConcurrency_raw();
+    return res;
+}
+
+inline bool CreateFromCAMTemplateInput::maxConcurrency(int value)
+{
+    return maxConcurrency_raw(value);
+}
 }// namespace cam
 }// namespace adsk
 
@@ -0,0 +1,183 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "../../Core/Base.h"
+#include "../CamTypeDefs.h"
+#include <string>
+#include <vector>
+
+// THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
+// THIS HEADER FILE WILL BE GENERATED FROM NIDL.
+#include "../../Core/OSMacros.h"
+
+#ifdef CAMXINTERFACE_EXPORTS
+# ifdef __COMPILING_ADSK_CAM_CREATEFROMCAMTEMPLATERESULTS_CPP__
+# define ADSK_CAM_CREATEFROMCAMTEMPLATERESULTS_API XI_EXPORT
+# else
+# define ADSK_CAM_CREATEFROMCAMTEMPLATERESULTS_API
+# endif
+#else
+# define ADSK_CAM_CREATEFROMCAMTEMPLATERESULTS_API XI_IMPORT
+#endif
+
+namespace adsk { namespace cam {
+    class GenerateToolpathFuture;
+    class OperationBase;
+    class Setup;
+}}
+
+namespace adsk { namespace cam {
+
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// Object returned when using the createFromCAMTemplate method of the Setups collection to instantiate a template in
+/// many setups. It contains the operations, folders and patterns created in each setup and the error of each setup
+/// the template could not be instantiated in.
+class CreateFromCAMTemplateResults : public core::Base {
+public:
+
+    /// Returns the setups the template was instantiated in, in the order they were passed.
+    std::vector<core::Ptr<Setup>> setups() const;
+
+    /// Returns whether the template was instantiated successfully in each setup. The array has one entry for each setup, in the order of setups.
+    std::vector<bool> isSuccess() const;
+
+    /// Returns the error message of each setup, or an empty string if the template was instantiated successfully. The array has one entry for each setup, in the order of setups.
+    std::vector<std::string> errors() const;
+
+    /// Returns the operations, folders and patterns created from the template in a setup.
+    /// setupIndex : The index of the setup in setups.
+    /// Returns an array containing all of the operations, folders and patterns created in the setup.
+    std::vector<core::Ptr<OperationBase>> operations(int setupIndex) const;
+
+    /// Returns the operations, folders and patterns created in all setups, ordered by setup.
+    std::vector<core::Ptr<OperationBase>> allOperations() const;
+
+    /// Returns the future of the toolpath generation of the created operations, or null if the generation mode of the input
+    /// did not generate them.
+    core::Ptr<GenerateToolpathFuture> generateToolpathFuture() const;
+
+    /// Returns the time in seconds spent instantiating the template, excluding the toolpath generation.
+    double duration() const;
+
+    ADSK_CAM_CREATEFROMCAMTEMPLATERESULTS_API static const char* classType();
+    ADSK_CAM_CREATEFROMCAMTEMPLATERESULTS_API const char* objectType() const override;
+    ADSK_CAM_CREATEFROMCAMTEMPLATERESULTS_API void* queryInterface(const char* id) const override;
+    ADSK_CAM_CREATEFROMCAMTEMPLATERESULTS_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual Setup** setups_raw(size_t& return_size) const = 0;
+    virtual bool* isSuccess_raw(size_t& return_size) const = 0;
+    virtual char** errors_raw(size_t& return_size) const = 0;
+    virtual OperationBase** operations_raw(int setupIndex, size_t& return_size) const = 0;
+    virtual OperationBase** allOperations_raw(size_t& return_size) const = 0;
+    virtual GenerateToolpathFuture* generateToolpathFuture_raw() const = 0;
+    virtual double duration_raw() const = 0;
+};
+
+// Inline wrappers
+
+inline std::vector<core::Ptr<Setup>> CreateFromCAMTemplateResults::setups() const
+{
+    std::vector<core::Ptr<Setup>> res;
+    size_t s;
+
+    Setup** p= setups_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<bool> CreateFromCAMTemplateResults::isSuccess() const
+{
+    std::vector<bool> res;
+    size_t s;
+
+    bool* p= isSuccess_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<std::string> CreateFromCAMTemplateResults::errors() const
+{
+    std::vector<std::string> res;
+    size_t s;
+
+    char** p= errors_raw(s);
+    if(p)
+    {
+        res.resize(s);
+        for(size_t i=0; i<s; ++i)
+        {
+            char* pChar = p[i];
+            if(pChar)
+                res[i] = pChar;
+            core::DeallocateArray(pChar);
+        }
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<core::Ptr<OperationBase>> CreateFromCAMTemplateResults::operations(int setupIndex) const
+{
+    std::vector<core::Ptr<OperationBase>> res;
+    size_t s;
+
+    OperationBase** p= operations_raw(setupIndex, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<core::Ptr<OperationBase>> CreateFromCAMTemplateResults::allOperations() const
+{
+    std::vector<core::Ptr<OperationBase>> res;
+    size_t s;
+
+    OperationBase** p= allOperations_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline core::Ptr<GenerateToolpathFuture> CreateFromCAMTemplateResults::generateToolpathFuture() const
+{
+    core::Ptr<GenerateToolpathFuture> res = generateToolpathFuture_raw();
+    return res;
+}
+
+inline double CreateFromCAMTemplateResults::duration() const
+{
+    double res = duration_raw();
+    return res;
+}
+}// namespace cam
+}// namespace adsk
+
+#undef ADSK_CAM_CREATEFROMCAMTEMPLATERESULTS_API
\ No newline at end of file
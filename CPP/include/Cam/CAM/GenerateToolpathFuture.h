@@ -28,6 +28,7 @@
 
 namespace adsk { namespace cam {
     class Operations;
+    class ToolpathGeneratedEvent;
 }}
 
 namespace adsk { namespace cam {
@@ -54,6 +55,15 @@ public:
     /// Returns the number of tasks of operations whose generation is complete.
     int numberOfCompletedTasks() const;
 
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// The operationGenerated event fires each time the generation of a single operation has finished,
+    /// successfully or not. The event allows processing generated operations, for instance post processing them,
+    /// while other operations are still being generated, instead of polling numberOfCompleted.
+    core::Ptr<ToolpathGeneratedEvent> operationGenerated() const;
+
     ADSK_CAM_GENERATETOOLPATHFUTURE_API static const char* classType();
     ADSK_CAM_GENERATETOOLPATHFUTURE_API const char* objectType() const override;
     ADSK_CAM_GENERATETOOLPATHFUTURE_API void* queryInterface(const char* id) const override;
@@ -68,6 +78,7 @@ private:
     virtual bool isGenerationCompleted_raw() const = 0;
     virtual int numberOfTasks_raw() const = 0;
     virtual int numberOfCompletedTasks_raw() const = 0;
+    virtual ToolpathGeneratedEvent* operationGenerated_raw() const = 0;
 };
 
 // Inline wrappers
@@ -107,6 +118,12 @@ inline int GenerateToolpathFuture::numberOfCompletedTasks() const
     int res = numberOfCompletedTasks_raw();
     return res;
 }
+
+inline core::Ptr<ToolpathGeneratedEvent> GenerateToolpathFuture::operationGenerated() const
+{
+    core::Ptr<ToolpathGeneratedEvent> res = operationGenerated_raw();
+    return res;
+}
 }// namespace cam
 }// namespace adsk
 
@@ -0,0 +1,356 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "../../Core/Base.h"
+#include "../CamTypeDefs.h"
+#include <vector>
+
+// THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
+// THIS HEADER FILE WILL BE GENERATED FROM NIDL.
+#include "../../Core/OSMacros.h"
+
+#ifdef CAMXINTERFACE_EXPORTS
+# ifdef __COMPILING_ADSK_CAM_INSPECTIONRESULTSDATA_CPP__
+# define ADSK_CAM_INSPECTIONRESULTSDATA_API XI_EXPORT
+# else
+# define ADSK_CAM_INSPECTIONRESULTSDATA_API
+# endif
+#else
+# define ADSK_CAM_INSPECTIONRESULTSDATA_API XI_IMPORT
+#endif
+
+namespace adsk { namespace cam {
+
+/// !!!!! Warning !!!!!
+/// ! This is hidden and not officially supported
+/// !!!!! Warning !!!!!
+/// 
+/// The measured results of all the surface inspection paths of a measure, as flat arrays instead of individual objects.
+/// The points of all paths are stored one after another in the order of CAMMeasure.inspectionPathResults, and
+/// pathStartIndices gives the index of the first point of each path. Point i of the arrays holds the same values as the
+/// InspectionPointResult objects of the paths.
+/// All arrays can be read in chunks by specifying a start index and a count.
+/// All values are in the Fusion's internal units which for positional and length values is CM.
+class InspectionResultsData : public core::Base {
+public:
+
+    /// Returns the total number of inspection points of all paths.
+    int pointCount() const;
+
+    /// Returns the index of the first point of each inspection path. The array has one entry for each path.
+    std::vector<int> pathStartIndices() const;
+
+    /// Returns the nominal position of each inspection point as an array of doubles where they are the x, y, z components of each point.
+    /// startIndex : The index of the first point to return.
+    /// count : The number of points to return. Use -1 to return all points from startIndex to the end.
+    /// Returns an array of 3 * count values.
+    std::vector<double> nominalPositions(int startIndex = 0, int count = -1) const;
+
+    /// Returns the projected position of each inspection point as an array of doubles where they are the x, y, z components of each point.
+    /// startIndex : The index of the first point to return.
+    /// count : The number of points to return. Use -1 to return all points from startIndex to the end.
+    /// Returns an array of 3 * count values.
+    std::vector<double> projectedPoints(int startIndex = 0, int count = -1) const;
+
+    /// Returns the contact position of each inspection point as an array of doubles where they are the x, y, z components of each point.
+    /// startIndex : The index of the first point to return.
+    /// count : The number of points to return. Use -1 to return all points from startIndex to the end.
+    /// Returns an array of 3 * count values.
+    std::vector<double> contacts(int startIndex = 0, int count = -1) const;
+
+    /// Returns the deviation vector from nominal of each inspection point as an array of doubles where they are the x, y, z components of each vector.
+    /// startIndex : The index of the first point to return.
+    /// count : The number of points to return. Use -1 to return all points from startIndex to the end.
+    /// Returns an array of 3 * count values.
+    std::vector<double> deltas(int startIndex = 0, int count = -1) const;
+
+    /// Returns the offset of each inspection point.
+    /// startIndex : The index of the first point to return.
+    /// count : The number of points to return. Use -1 to return all points from startIndex to the end.
+    /// Returns an array of count values.
+    std::vector<double> offsets(int startIndex = 0, int count = -1) const;
+
+    /// Returns the deviation of each inspection point.
+    /// startIndex : The index of the first point to return.
+    /// count : The number of points to return. Use -1 to return all points from startIndex to the end.
+    /// Returns an array of count values.
+    std::vector<double> deviations(int startIndex = 0, int count = -1) const;
+
+    /// Returns the error adjusted by the allowable tolerance of each inspection point.
+    /// startIndex : The index of the first point to return.
+    /// count : The number of points to return. Use -1 to return all points from startIndex to the end.
+    /// Returns an array of count values.
+    std::vector<double> errors(int startIndex = 0, int count = -1) const;
+
+    /// Returns the state of each inspection point. The values are obtained from the InspectionPointState enum and returned as integers.
+    /// startIndex : The index of the first point to return.
+    /// count : The number of points to return. Use -1 to return all points from startIndex to the end.
+    /// Returns an array of count values.
+    std::vector<int> states(int startIndex = 0, int count = -1) const;
+
+    /// Returns the number of points with the WithinTolerance state.
+    int withinToleranceCount() const;
+
+    /// Returns the number of points with the AboveTolerance or BelowTolerance state.
+    int outOfToleranceCount() const;
+
+    /// Returns the smallest deviation of all projected points. Unprojected points are ignored by all statistics.
+    double minDeviation() const;
+
+    /// Returns the largest deviation of all projected points.
+    double maxDeviation() const;
+
+    /// Returns the mean deviation of all projected points.
+    double meanDeviation() const;
+
+    /// Returns the standard deviation of the deviations of all projected points.
+    double standardDeviation() const;
+
+    /// Calculates the process capability index Cpk of the deviations of all projected points for a tolerance band, which is
+    /// the distance from the mean deviation to the nearest tolerance limit divided by three standard deviations.
+    /// lowerTolerance : The lower limit of the tolerance band.
+    /// upperTolerance : The upper limit of the tolerance band.
+    /// Returns the Cpk value, or NaN if the index is undefined because there are fewer than two projected points or all
+    /// deviations are equal. A Cpk of 0 means the mean deviation lies on a tolerance limit.
+    double processCapability(double lowerTolerance, double upperTolerance) const;
+
+    /// Maps the deviation of each inspection point to a color, for instance to display the points as custom graphics with
+    /// per-vertex coloring. Deviations at lowerValue are blue, deviations halfway between the values are green and deviations
+    /// at upperValue are red; deviations outside the values use the color of the nearest value. Unprojected points are gray.
+    /// lowerValue : The deviation mapped to blue.
+    /// upperValue : The deviation mapped to red.
+    /// startIndex : The index of the first point to return.
+    /// count : The number of points to return. Use -1 to return all points from startIndex to the end.
+    /// Returns the red, green, blue and alpha values of each point in the range 0 to 255, as an array of 4 * count values
+    /// that can be used as the colors of a CustomGraphicsCoordinates object.
+    std::vector<short> colorMap(double lowerValue, double upperValue, int startIndex = 0, int count = -1) const;
+
+    ADSK_CAM_INSPECTIONRESULTSDATA_API static const char* classType();
+    ADSK_CAM_INSPECTIONRESULTSDATA_API const char* objectType() const override;
+    ADSK_CAM_INSPECTIONRESULTSDATA_API void* queryInterface(const char* id) const override;
+    ADSK_CAM_INSPECTIONRESULTSDATA_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual int pointCount_raw() const = 0;
+    virtual int* pathStartIndices_raw(size_t& return_size) const = 0;
+    virtual double* nominalPositions_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual double* projectedPoints_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual double* contacts_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual double* deltas_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual double* offsets_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual double* deviations_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual double* errors_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual int* states_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual int withinToleranceCount_raw() const = 0;
+    virtual int outOfToleranceCount_raw() const = 0;
+    virtual double minDeviation_raw() const = 0;
+    virtual double maxDeviation_raw() const = 0;
+    virtual double meanDeviation_raw() const = 0;
+    virtual double standardDeviation_raw() const = 0;
+    virtual double processCapability_raw(double lowerTolerance, double upperTolerance) const = 0;
+    virtual short* colorMap_raw(double lowerValue, double upperValue, int startIndex, int count, size_t& return_size) const = 0;
+};
+
+// Inline wrappers
+
+inline int InspectionResultsData::pointCount() const
+{
+    int res = pointCount_raw();
+    return res;
+}
+
+inline std::vector<int> InspectionResultsData::pathStartIndices() const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= pathStartIndices_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> InspectionResultsData::nominalPositions(int startIndex, int count) const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= nominalPositions_raw(startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> InspectionResultsData::projectedPoints(int startIndex, int count) const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= projectedPoints_raw(startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> InspectionResultsData::contacts(int startIndex, int count) const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= contacts_raw(startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> InspectionResultsData::deltas(int startIndex, int count) const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= deltas_raw(startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> InspectionResultsData::offsets(int startIndex, int count) const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= offsets_raw(startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> InspectionResultsData::deviations(int startIndex, int count) const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= deviations_raw(startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> InspectionResultsData::errors(int startIndex, int count) const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= errors_raw(startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<int> InspectionResultsData::states(int startIndex, int count) const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= states_raw(startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline int InspectionResultsData::withinToleranceCount() const
+{
+    int res = withinToleranceCount_raw();
+    return res;
+}
+
+inline int InspectionResultsData::outOfToleranceCount() const
+{
+    int res = outOfToleranceCount_raw();
+    return res;
+}
+
+inline double InspectionResultsData::minDeviation() const
+{
+    double res = minDeviation_raw();
+    return res;
+}
+
+inline double InspectionResultsData::maxDeviation() const
+{
+    double res = maxDeviation_raw();
+    return res;
+}
+
+inline double InspectionResultsData::meanDeviation() const
+{
+    double res = meanDeviation_raw();
+    return res;
+}
+
+inline double InspectionResultsData::standardDeviation() const
+{
+    double res = standardDeviation_raw();
+    return res;
+}
+
+inline double InspectionResultsData::processCapability(double lowerTolerance, double upperTolerance) const
+{
+    double res = processCapability_raw(lowerTolerance, upperTolerance);
+    return res;
+}
+
+inline std::vector<short> InspectionResultsData::colorMap(double lowerValue, double upperValue, int startIndex, int count) const
+{
+    std::vector<short> res;
+    size_t s;
+
+    short* p= colorMap_raw(lowerValue, upperValue, startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+}// namespace cam
+}// namespace adsk
+
+#undef ADSK_CAM_INSPECTIONRESULTSDATA_API
\ No newline at end of file
@@ -0,0 +1,240 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "../../Core/Base.h"
+#include "../CamTypeDefs.h"
+#include <vector>
+
+// THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
+// THIS HEADER FILE WILL BE GENERATED FROM NIDL.
+#include "../../Core/OSMacros.h"
+
+#ifdef CAMXINTERFACE_EXPORTS
+# ifdef __COMPILING_ADSK_CAM_KINEMATICMACHININGTIME_CPP__
+# define ADSK_CAM_KINEMATICMACHININGTIME_API XI_EXPORT
+# else
+# define ADSK_CAM_KINEMATICMACHININGTIME_API
+# endif
+#else
+# define ADSK_CAM_KINEMATICMACHININGTIME_API XI_IMPORT
+#endif
+
+namespace adsk { namespace cam {
+    class OperationBase;
+}}
+
+namespace adsk { namespace cam {
+
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// Object returned when using the getKinematicMachiningTime method from the CAM class.
+/// Unlike MachiningTime, which assumes every move runs at its programmed feedrate, the times are calculated
+/// by walking the moves of the toolpath and limiting the speed by the maximum speed, acceleration and jerk of each
+/// machine axis and by the look-ahead and block processing speed of the controller.
+/// Moves are indexed the same way as the points of the ToolpathData of the operation: move i ends at point i.
+/// The distances, the tool change count and the tool change time are the same as those of MachiningTime.
+class KinematicMachiningTime : public core::Base {
+public:
+
+    /// Gets the machining time in seconds.
+    double machiningTime() const;
+
+    /// Gets the feed distance in centimeters.
+    double feedDistance() const;
+
+    /// Gets the total feed time in seconds.
+    double totalFeedTime() const;
+
+    /// Gets the rapid distance in centimeters.
+    double rapidDistance() const;
+
+    /// Gets the total rapid time in seconds.
+    double totalRapidTime() const;
+
+    /// Gets the number of tool changes.
+    int toolChangeCount() const;
+
+    /// Gets the total tool change time in seconds.
+    double totalToolChangeTime() const;
+
+    /// Gets the operations that were estimated, in machining order.
+    std::vector<core::Ptr<OperationBase>> operations() const;
+
+    /// Gets the machining time of each operation in seconds, excluding tool changes.
+    /// The array has the same size and order as the operations array.
+    std::vector<double> operationTimes() const;
+
+    /// Gets the time of each move of an operation in seconds.
+    /// The result is empty if isMoveTimeIncluded was false on the input.
+    /// operationIndex : The index of the operation in the operations array.
+    /// startIndex : The index of the first move to return.
+    /// count : The number of moves to return. Use -1 to return all moves from startIndex to the end of the toolpath.
+    /// Returns an array of count values.
+    std::vector<double> moveTimes(int operationIndex, int startIndex = 0, int count = -1) const;
+
+    /// Gets the average feedrate achieved during each move of an operation in centimeters per second.
+    /// The result is empty if isMoveTimeIncluded was false on the input.
+    /// operationIndex : The index of the operation in the operations array.
+    /// startIndex : The index of the first move to return.
+    /// count : The number of moves to return. Use -1 to return all moves from startIndex to the end of the toolpath.
+    /// Returns an array of count values.
+    std::vector<double> achievedFeedrates(int operationIndex, int startIndex = 0, int count = -1) const;
+
+    /// Gets what limited the speed of each move of an operation. The values are obtained from the
+    /// MachiningTimeLimitingFactors enum and returned as integers.
+    /// The result is empty if isMoveTimeIncluded was false on the input.
+    /// operationIndex : The index of the operation in the operations array.
+    /// startIndex : The index of the first move to return.
+    /// count : The number of moves to return. Use -1 to return all moves from startIndex to the end of the toolpath.
+    /// Returns an array of count values.
+    std::vector<int> limitingFactors(int operationIndex, int startIndex = 0, int count = -1) const;
+
+    ADSK_CAM_KINEMATICMACHININGTIME_API static const char* classType();
+    ADSK_CAM_KINEMATICMACHININGTIME_API const char* objectType() const override;
+    ADSK_CAM_KINEMATICMACHININGTIME_API void* queryInterface(const char* id) const override;
+    ADSK_CAM_KINEMATICMACHININGTIME_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual double machiningTime_raw() const = 0;
+    virtual double feedDistance_raw() const = 0;
+    virtual double totalFeedTime_raw() const = 0;
+    virtual double rapidDistance_raw() const = 0;
+    virtual double totalRapidTime_raw() const = 0;
+    virtual int toolChangeCount_raw() const = 0;
+    virtual double totalToolChangeTime_raw() const = 0;
+    virtual OperationBase** operations_raw(size_t& return_size) const = 0;
+    virtual double* operationTimes_raw(size_t& return_size) const = 0;
+    virtual double* moveTimes_raw(int operationIndex, int startIndex, int count, size_t& return_size) const = 0;
+    virtual double* achievedFeedrates_raw(int operationIndex, int startIndex, int count, size_t& return_size) const = 0;
+    virtual int* limitingFactors_raw(int operationIndex, int startIndex, int count, size_t& return_size) const = 0;
+};
+
+// Inline wrappers
+
+inline double KinematicMachiningTime::machiningTime() const
+{
+    double res = machiningTime_raw();
+    return res;
+}
+
+inline double KinematicMachiningTime::feedDistance() const
+{
+    double res = feedDistance_raw();
+    return res;
+}
+
+inline double KinematicMachiningTime::totalFeedTime() const
+{
+    double res = totalFeedTime_raw();
+    return res;
+}
+
+inline double KinematicMachiningTime::rapidDistance() const
+{
+    double res = rapidDistance_raw();
+    return res;
+}
+
+inline double KinematicMachiningTime::totalRapidTime() const
+{
+    double res = totalRapidTime_raw();
+    return res;
+}
+
+inline int KinematicMachiningTime::toolChangeCount() const
+{
+    int res = toolChangeCount_raw();
+    return res;
+}
+
+inline double KinematicMachiningTime::totalToolChangeTime() const
+{
+    double res = totalToolChangeTime_raw();
+    return res;
+}
+
+inline std::vector<core::Ptr<OperationBase>> KinematicMachiningTime::operations() const
+{
+    std::vector<core::Ptr<OperationBase>> res;
+    size_t s;
+
+    OperationBase** p= operations_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> KinematicMachiningTime::operationTimes() const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= operationTimes_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> KinematicMachiningTime::moveTimes(int operationIndex, int startIndex, int count) const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= moveTimes_raw(operationIndex, startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> KinematicMachiningTime::achievedFeedrates(int operationIndex, int startIndex, int count) const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= achievedFeedrates_raw(operationIndex, startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<int> KinematicMachiningTime::limitingFactors(int operationIndex, int startIndex, int count) const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= limitingFactors_raw(operationIndex, startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+}// namespace cam
+}// namespace adsk
+
+#undef ADSK_CAM_KINEMATICMACHININGTIME_API
\ No newline at end of file
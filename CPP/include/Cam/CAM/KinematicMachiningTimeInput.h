@@ -0,0 +1,141 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "../../Core/Base.h"
+#include "../CamTypeDefs.h"
+
+// THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
+// THIS HEADER FILE WILL BE GENERATED FROM NIDL.
+#include "../../Core/OSMacros.h"
+
+#ifdef CAMXINTERFACE_EXPORTS
+# ifdef __COMPILING_ADSK_CAM_KINEMATICMACHININGTIMEINPUT_CPP__
+# define ADSK_CAM_KINEMATICMACHININGTIMEINPUT_API XI_EXPORT
+# else
+# define ADSK_CAM_KINEMATICMACHININGTIMEINPUT_API
+# endif
+#else
+# define ADSK_CAM_KINEMATICMACHININGTIMEINPUT_API XI_IMPORT
+#endif
+
+namespace adsk { namespace cam {
+    class Machine;
+}}
+
+namespace adsk { namespace cam {
+
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// Defines the operations and the options for a kinematic machining time estimate.
+/// Use the CAM.createKinematicMachiningTimeInput method to create a new input object and pass it to
+/// the CAM.getKinematicMachiningTime method.
+class KinematicMachiningTimeInput : public core::Base {
+public:
+
+    /// Returns the Operation, Setup, Folder, or Pattern object or the ObjectCollection of these objects
+    /// the input was created for.
+    core::Ptr<core::Base> operations() const;
+
+    /// Gets and sets the machine whose axis speeds, accelerations, jerks and controller look-ahead are used.
+    /// Null by default, which uses the machine of the parent setup of each operation.
+    core::Ptr<Machine> machine() const;
+    bool machine(const core::Ptr<Machine>& value);
+
+    /// Gets and sets the feed scale value (%) to use. 100 by default.
+    double feedScale() const;
+    bool feedScale(double value);
+
+    /// Gets and sets the tool change time in seconds. 0 by default.
+    double toolChangeTime() const;
+    bool toolChangeTime(double value);
+
+    /// Gets and sets whether the time, feedrate and limiting factor of every single move are kept in the result.
+    /// Leave this off if only the totals and the times per operation are needed, to reduce the memory used by the result.
+    /// False by default.
+    bool isMoveTimeIncluded() const;
+    bool isMoveTimeIncluded(bool value);
+
+    ADSK_CAM_KINEMATICMACHININGTIMEINPUT_API static const char* classType();
+    ADSK_CAM_KINEMATICMACHININGTIMEINPUT_API const char* objectType() const override;
+    ADSK_CAM_KINEMATICMACHININGTIMEINPUT_API void* queryInterface(const char* id) const override;
+    ADSK_CAM_KINEMATICMACHININGTIMEINPUT_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual core::Base* operations_raw() const = 0;
+    virtual Machine* machine_raw() const = 0;
+    virtual bool machine_raw(Machine* value) = 0;
+    virtual double feedScale_raw() const = 0;
+    virtual bool feedScale_raw(double value) = 0;
+    virtual double toolChangeTime_raw() const = 0;
+    virtual bool toolChangeTime_raw(double value) = 0;
+    virtual bool isMoveTimeIncluded_raw() const = 0;
+    virtual bool isMoveTimeIncluded_raw(bool value) = 0;
+};
+
+// Inline wrappers
+
+inline core::Ptr<core::Base> KinematicMachiningTimeInput::operations() const
+{
+    core::Ptr<core::Base> res = operations_raw();
+    return res;
+}
+
+inline core::Ptr<Machine> KinematicMachiningTimeInput::machine() const
+{
+    core::Ptr<Machine> res = machine_raw();
+    return res;
+}
+
+inline bool KinematicMachiningTimeInput::machine(const core::Ptr<Machine>& value)
+{
+    return machine_raw(value.get());
+}
+
+inline double KinematicMachiningTimeInput::feedScale() const
+{
+    double res = feedScale_raw();
+    return res;
+}
+
+inline bool KinematicMachiningTimeInput::feedScale(double value)
+{
+    return feedScale_raw(value);
+}
+
+inline double KinematicMachiningTimeInput::toolChangeTime() const
+{
+    double res = toolChangeTime_raw();
+    return res;
+}
+
+inline bool KinematicMachiningTimeInput::toolChangeTime(double value)
+{
+    return toolChangeTime_raw(value);
+}
+
+inline bool KinematicMachiningTimeInput::isMoveTimeIncluded() const
+{
+    bool res = isMoveTimeIncluded_raw();
+    return res;
+}
+
+inline bool KinematicMachiningTimeInput::isMoveTimeIncluded(bool value)
+{
+    return isMoveTimeIncluded_raw(value);
+}
+}// namespace cam
+}// namespace adsk
+
+#undef ADSK_CAM_KINEMATICMACHININGTIMEINPUT_API
\ No newline at end of file
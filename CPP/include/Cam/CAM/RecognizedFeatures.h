@@ -0,0 +1,612 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "../../Core/Base.h"
+#include "../CamTypeDefs.h"
+#include <vector>
+
+// THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
+// THIS HEADER FILE WILL BE GENERATED FROM NIDL.
+#include "../../Core/OSMacros.h"
+
+#ifdef CAMXINTERFACE_EXPORTS
+# ifdef __COMPILING_ADSK_CAM_RECOGNIZEDFEATURES_CPP__
+# define ADSK_CAM_RECOGNIZEDFEATURES_API XI_EXPORT
+# else
+# define ADSK_CAM_RECOGNIZEDFEATURES_API
+# endif
+#else
+# define ADSK_CAM_RECOGNIZEDFEATURES_API XI_IMPORT
+#endif
+
+namespace adsk { namespace cam {
+    class RecognizedFeatures;
+    class RecognizedFeaturesInput;
+}}
+
+namespace adsk { namespace cam {
+
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// The holes and pockets recognized on several bodies, as flat arrays instead of individual objects.
+/// Holes are ordered by body and pockets by body and attack vector. The segments of all holes are stored one after another,
+/// as are the boundaries of all pockets, the points of all boundaries and the faces of all pockets; the start indices
+/// arrays give the index of the first item of each hole, pocket or boundary.
+/// Faces are identified by their tempId, which is unique within the body of the hole or pocket.
+class RecognizedFeatures : public core::Base {
+public:
+
+    /// Recognizes the holes and pockets on all bodies of the input. Bodies and attack vectors are processed in parallel.
+    /// input : Input object that contains the bodies, attack vectors and settings.
+    /// Returns the recognized holes and pockets or null if the recognition failed.
+    static core::Ptr<RecognizedFeatures> recognizeFeatures(const core::Ptr<RecognizedFeaturesInput>& input);
+
+    /// Returns the time in seconds spent recognizing the features.
+    double duration() const;
+
+    /// Returns the number of holes recognized on all bodies.
+    int holeCount() const;
+
+    /// Returns the index into the bodies of the input of the body of each hole. The array has one entry for each hole.
+    std::vector<int> holeBodyIndices() const;
+
+    /// Returns the unit vector that points straight up out of each hole, as an array of doubles where they are the x, y, z components
+    /// of each vector.
+    std::vector<double> holeAxes() const;
+
+    /// Returns the center of the top of each hole in centimeters, as an array of doubles where they are the x, y, z components of each point.
+    std::vector<double> holeTops() const;
+
+    /// Returns the center of the bottom of each hole in centimeters, as an array of doubles where they are the x, y, z components of each point.
+    std::vector<double> holeBottoms() const;
+
+    /// Returns the top diameter of each hole in centimeters. The array has one entry for each hole.
+    std::vector<double> holeTopDiameters() const;
+
+    /// Returns the bottom diameter of each hole in centimeters. The array has one entry for each hole.
+    std::vector<double> holeBottomDiameters() const;
+
+    /// Returns the total length of each hole in centimeters. The array has one entry for each hole.
+    std::vector<double> holeLengths() const;
+
+    /// Returns whether each hole is a through hole. The array has one entry for each hole.
+    std::vector<bool> holeIsThrough() const;
+
+    /// Returns whether at least one segment of each hole is threaded. The array has one entry for each hole.
+    std::vector<bool> holeIsThreaded() const;
+
+    /// Returns the index of the first segment of each hole. The segments of a hole are ordered from top to bottom. The array has one entry for each hole.
+    std::vector<int> holeSegmentStartIndices() const;
+
+    /// Returns the type of each hole segment. The values are obtained from the HoleSegmentType enum and returned as integers. The array has one entry for each hole segment.
+    std::vector<int> segmentTypes() const;
+
+    /// Returns the top diameter of each hole segment in centimeters. The array has one entry for each hole segment.
+    std::vector<double> segmentTopDiameters() const;
+
+    /// Returns the bottom diameter of each hole segment in centimeters. The array has one entry for each hole segment.
+    std::vector<double> segmentBottomDiameters() const;
+
+    /// Returns the height of each hole segment in centimeters. The array has one entry for each hole segment.
+    std::vector<double> segmentHeights() const;
+
+    /// Returns whether each hole segment is threaded. The array has one entry for each hole segment.
+    std::vector<bool> segmentIsThreaded() const;
+
+    /// Returns the tempId of the face of each hole segment. The array has one entry for each hole segment.
+    std::vector<int> segmentFaceTempIds() const;
+
+    /// Returns the number of pockets recognized on all bodies for all attack vectors.
+    int pocketCount() const;
+
+    /// Returns the index into the bodies of the input of the body of each pocket. The array has one entry for each pocket.
+    std::vector<int> pocketBodyIndices() const;
+
+    /// Returns the index of the attack vector each pocket was recognized for. The array has one entry for each pocket.
+    std::vector<int> pocketAttackVectorIndices() const;
+
+    /// Returns the depth of each pocket in centimeters. The array has one entry for each pocket.
+    std::vector<double> pocketDepths() const;
+
+    /// Returns whether each pocket is a through pocket. The array has one entry for each pocket.
+    std::vector<bool> pocketIsThrough() const;
+
+    /// Returns whether the outer boundary of each pocket is a single closed curve. The array has one entry for each pocket.
+    std::vector<bool> pocketIsClosed() const;
+
+    /// Returns the type of the bottom edge of each pocket. The values are obtained from the RecognizedPocketBottomType enum
+    /// and returned as integers. The array has one entry for each pocket.
+    std::vector<int> pocketBottomTypes() const;
+
+    /// Returns the index of the first boundary of each pocket. The outer boundaries of a pocket come before its islands. The array has one entry for each pocket.
+    std::vector<int> pocketBoundaryStartIndices() const;
+
+    /// Returns whether each boundary is an island rather than an outer boundary. The array has one entry for each boundary.
+    std::vector<bool> boundaryIsIsland() const;
+
+    /// Returns the index of the first point of each boundary. The array has one entry for each boundary.
+    std::vector<int> boundaryPointStartIndices() const;
+
+    /// Returns the points of the polylines approximating all boundaries in centimeters, as an array of doubles where they are
+    /// the x, y, z components of each point.
+    std::vector<double> boundaryPoints() const;
+
+    /// Returns the index of the first face of each pocket in pocketFaceTempIds. The array has one entry for each pocket.
+    std::vector<int> pocketFaceStartIndices() const;
+
+    /// Returns the tempIds of the faces making up each pocket.
+    std::vector<int> pocketFaceTempIds() const;
+
+    ADSK_CAM_RECOGNIZEDFEATURES_API static const char* classType();
+    ADSK_CAM_RECOGNIZEDFEATURES_API const char* objectType() const override;
+    ADSK_CAM_RECOGNIZEDFEATURES_API void* queryInterface(const char* id) const override;
+    ADSK_CAM_RECOGNIZEDFEATURES_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    ADSK_CAM_RECOGNIZEDFEATURES_API static RecognizedFeatures* recognizeFeatures_raw(RecognizedFeaturesInput* input);
+    virtual double duration_raw() const = 0;
+    virtual int holeCount_raw() const = 0;
+    virtual int* holeBodyIndices_raw(size_t& return_size) const = 0;
+    virtual double* holeAxes_raw(size_t& return_size) const = 0;
+    virtual double* holeTops_raw(size_t& return_size) const = 0;
+    virtual double* holeBottoms_raw(size_t& return_size) const = 0;
+    virtual double* holeTopDiameters_raw(size_t& return_size) const = 0;
+    virtual double* holeBottomDiameters_raw(size_t& return_size) const = 0;
+    virtual double* holeLengths_raw(size_t& return_size) const = 0;
+    virtual bool* holeIsThrough_raw(size_t& return_size) const = 0;
+    virtual bool* holeIsThreaded_raw(size_t& return_size) const = 0;
+    virtual int* holeSegmentStartIndices_raw(size_t& return_size) const = 0;
+    virtual int* segmentTypes_raw(size_t& return_size) const = 0;
+    virtual double* segmentTopDiameters_raw(size_t& return_size) const = 0;
+    virtual double* segmentBottomDiameters_raw(size_t& return_size) const = 0;
+    virtual double* segmentHeights_raw(size_t& return_size) const = 0;
+    virtual bool* segmentIsThreaded_raw(size_t& return_size) const = 0;
+    virtual int* segmentFaceTempIds_raw(size_t& return_size) const = 0;
+    virtual int pocketCount_raw() const = 0;
+    virtual int* pocketBodyIndices_raw(size_t& return_size) const = 0;
+    virtual int* pocketAttackVectorIndices_raw(size_t& return_size) const = 0;
+    virtual double* pocketDepths_raw(size_t& return_size) const = 0;
+    virtual bool* pocketIsThrough_raw(size_t& return_size) const = 0;
+    virtual bool* pocketIsClosed_raw(size_t& return_size) const = 0;
+    virtual int* pocketBottomTypes_raw(size_t& return_size) const = 0;
+    virtual int* pocketBoundaryStartIndices_raw(size_t& return_size) const = 0;
+    virtual bool* boundaryIsIsland_raw(size_t& return_size) const = 0;
+    virtual int* boundaryPointStartIndices_raw(size_t& return_size) const = 0;
+    virtual double* boundaryPoints_raw(size_t& return_size) const = 0;
+    virtual int* pocketFaceStartIndices_raw(size_t& return_size) const = 0;
+    virtual int* pocketFaceTempIds_raw(size_t& return_size) const = 0;
+};
+
+// Inline wrappers
+
+inline core::Ptr<RecognizedFeatures> RecognizedFeatures::recognizeFeatures(const core::Ptr<RecognizedFeaturesInput>& input)
+{
+    core::Ptr<RecognizedFeatures> res = recognizeFeatures_raw(input.get());
+    return res;
+}
+
+inline double RecognizedFeatures::duration() const
+{
+    double res = duration_raw();
+    return res;
+}
+
+inline int RecognizedFeatures::holeCount() const
+{
+    int res = holeCount_raw();
+    return res;
+}
+
+inline std::vector<int> RecognizedFeatures::holeBodyIndices() const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= holeBodyIndices_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> RecognizedFeatures::holeAxes() const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= holeAxes_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> RecognizedFeatures::holeTops() const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= holeTops_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> RecognizedFeatures::holeBottoms() const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= holeBottoms_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> RecognizedFeatures::holeTopDiameters() const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= holeTopDiameters_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> RecognizedFeatures::holeBottomDiameters() const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= holeBottomDiameters_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> RecognizedFeatures::holeLengths() const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= holeLengths_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<bool> RecognizedFeatures::holeIsThrough() const
+{
+    std::vector<bool> res;
+    size_t s;
+
+    bool* p= holeIsThrough_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<bool> RecognizedFeatures::holeIsThreaded() const
+{
+    std::vector<bool> res;
+    size_t s;
+
+    bool* p= holeIsThreaded_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<int> RecognizedFeatures::holeSegmentStartIndices() const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= holeSegmentStartIndices_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<int> RecognizedFeatures::segmentTypes() const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= segmentTypes_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> RecognizedFeatures::segmentTopDiameters() const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= segmentTopDiameters_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> RecognizedFeatures::segmentBottomDiameters() const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= segmentBottomDiameters_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> RecognizedFeatures::segmentHeights() const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= segmentHeights_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<bool> RecognizedFeatures::segmentIsThreaded() const
+{
+    std::vector<bool> res;
+    size_t s;
+
+    bool* p= segmentIsThreaded_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<int> RecognizedFeatures::segmentFaceTempIds() const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= segmentFaceTempIds_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline int RecognizedFeatures::pocketCount() const
+{
+    int res = pocketCount_raw();
+    return res;
+}
+
+inline std::vector<int> RecognizedFeatures::pocketBodyIndices() const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= pocketBodyIndices_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<int> RecognizedFeatures::pocketAttackVectorIndices() const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= pocketAttackVectorIndices_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> RecognizedFeatures::pocketDepths() const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= pocketDepths_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<bool> RecognizedFeatures::pocketIsThrough() const
+{
+    std::vector<bool> res;
+    size_t s;
+
+    bool* p= pocketIsThrough_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<bool> RecognizedFeatures::pocketIsClosed() const
+{
+    std::vector<bool> res;
+    size_t s;
+
+    bool* p= pocketIsClosed_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<int> RecognizedFeatures::pocketBottomTypes() const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= pocketBottomTypes_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<int> RecognizedFeatures::pocketBoundaryStartIndices() const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= pocketBoundaryStartIndices_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<bool> RecognizedFeatures::boundaryIsIsland() const
+{
+    std::vector<bool> res;
+    size_t s;
+
+    bool* p= boundaryIsIsland_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<int> RecognizedFeatures::boundaryPointStartIndices() const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= boundaryPointStartIndices_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> RecognizedFeatures::boundaryPoints() const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= boundaryPoints_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<int> RecognizedFeatures::pocketFaceStartIndices() const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= pocketFaceStartIndices_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<int> RecognizedFeatures::pocketFaceTempIds() const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= pocketFaceTempIds_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+}// namespace cam
+}// namespace adsk
+
+#undef ADSK_CAM_RECOGNIZEDFEATURES_API
\ No newline at end of file
@@ -0,0 +1,214 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "../../Core/Base.h"
+#include "../CamTypeDefs.h"
+#include <vector>
+
+// THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
+// THIS HEADER FILE WILL BE GENERATED FROM NIDL.
+#include "../../Core/OSMacros.h"
+
+#ifdef CAMXINTERFACE_EXPORTS
+# ifdef __COMPILING_ADSK_CAM_RECOGNIZEDFEATURESINPUT_CPP__
+# define ADSK_CAM_RECOGNIZEDFEATURESINPUT_API XI_EXPORT
+# else
+# define ADSK_CAM_RECOGNIZEDFEATURESINPUT_API
+# endif
+#else
+# define ADSK_CAM_RECOGNIZEDFEATURESINPUT_API XI_IMPORT
+#endif
+
+namespace adsk { namespace cam {
+    class RecognizedFeaturesInput;
+    class RecognizedHolesInput;
+}}
+
+namespace adsk { namespace cam {
+
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// Object that contains the bodies, attack vectors and settings used by RecognizedFeatures.recognizeFeatures.
+class RecognizedFeaturesInput : public core::Base {
+public:
+
+    /// Creates an empty input object to be passed into RecognizedFeatures.recognizeFeatures.
+    /// The newly created input object.
+    static core::Ptr<RecognizedFeaturesInput> create();
+
+    /// Gets and sets the model bodies on which to recognize holes and pockets.
+    std::vector<core::Ptr<core::Base>> bodies() const;
+    bool bodies(const std::vector<core::Ptr<core::Base>>& value);
+
+    /// Gets and sets the vectors defining the orientations in which to search for pockets, as an array of doubles where they
+    /// are the x, y, z components of each vector. Each vector points down along the tool towards its tip and the pocket floors.
+    /// Pockets are recognized on every body for every attack vector. Empty by default, which uses the negative z axis.
+    std::vector<double> attackVectors() const;
+    bool attackVectors(const std::vector<double>& value);
+
+    /// Gets and sets whether holes are recognized. True by default.
+    bool isRecognizingHoles() const;
+    bool isRecognizingHoles(bool value);
+
+    /// Gets and sets whether pockets are recognized. True by default.
+    bool isRecognizingPockets() const;
+    bool isRecognizingPockets(bool value);
+
+    /// Gets and sets the settings used to recognize holes. Null by default, which uses the default settings.
+    core::Ptr<RecognizedHolesInput> holesInput() const;
+    bool holesInput(const core::Ptr<RecognizedHolesInput>& value);
+
+    /// Gets and sets the tolerance in centimeters used to approximate the pocket boundaries and islands by polylines. 0.001 by default.
+    double boundaryTolerance() const;
+    bool boundaryTolerance(double value);
+
+    /// Gets and sets the maximum number of bodies and attack vectors that are processed at the same time.
+    /// 0 uses the number of processor cores. 0 by default.
+    int maxConcurrency() const;
+    bool maxConcurrency(int value);
+
+    ADSK_CAM_RECOGNIZEDFEATURESINPUT_API static const char* classType();
+    ADSK_CAM_RECOGNIZEDFEATURESINPUT_API const char* objectType() const override;
+    ADSK_CAM_RECOGNIZEDFEATURESINPUT_API void* queryInterface(const char* id) const override;
+    ADSK_CAM_RECOGNIZEDFEATURESINPUT_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    ADSK_CAM_RECOGNIZEDFEATURESINPUT_API static RecognizedFeaturesInput* create_raw();
+    virtual core::Base** bodies_raw(size_t& return_size) const = 0;
+    virtual bool bodies_raw(core::Base** value, size_t value_size) = 0;
+    virtual double* attackVectors_raw(size_t& return_size) const = 0;
+    virtual bool attackVectors_raw(const double* value, size_t value_size) = 0;
+    virtual bool isRecognizingHoles_raw() const = 0;
+    virtual bool isRecognizingHoles_raw(bool value) = 0;
+    virtual bool isRecognizingPockets_raw() const = 0;
+    virtual bool isRecognizingPockets_raw(bool value) = 0;
+    virtual RecognizedHolesInput* holesInput_raw() const = 0;
+    virtual bool holesInput_raw(RecognizedHolesInput* value) = 0;
+    virtual double boundaryTolerance_raw() const = 0;
+    virtual bool boundaryTolerance_raw(double value) = 0;
+    virtual int maxConcurrency_raw() const = 0;
+    virtual bool maxConcurrency_raw(int value) = 0;
+};
+
+// Inline wrappers
+
+inline core::Ptr<RecognizedFeaturesInput> RecognizedFeaturesInput::create()
+{
+    core::Ptr<RecognizedFeaturesInput> res = create_raw();
+    return res;
+}
+
+inline std::vector<core::Ptr<core::Base>> RecognizedFeaturesInput::bodies() const
+{
+    std::vector<core::Ptr<core::Base>> res;
+    size_t s;
+
+    core::Base** p= bodies_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline bool RecognizedFeaturesInput::bodies(const std::vector<core::Ptr<core::Base>>& value)
+{
+    core::Base** value_ = new core::Base*[value.size()];
+    for(size_t i=0; i<value.size(); ++i)
+        value_[i] = value[i].get();
+
+    bool res = bodies_raw(value_, value.size());
+    delete[] value_;
+    return res;
+}
+
+inline std::vector<double> RecognizedFeaturesInput::attackVectors() const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= attackVectors_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline bool RecognizedFeaturesInput::attackVectors(const std::vector<double>& value)
+{
+    return attackVectors_raw(value.empty() ? nullptr : &value[0], value.size());
+}
+
+inline bool RecognizedFeaturesInput::isRecognizingHoles() const
+{
+    bool res = isRecognizingHoles_raw();
+    return res;
+}
+
+inline bool RecognizedFeaturesInput::isRecognizingHoles(bool value)
+{
+    return isRecognizingHoles_raw(value);
+}
+
+inline bool RecognizedFeaturesInput::isRecognizingPockets() const
+{
+    bool res = isRecognizingPockets_raw();
+    return res;
+}
+
+inline bool RecognizedFeaturesInput::isRecognizingPockets(bool value)
+{
+    return isRecognizingPockets_raw(value);
+}
+
+inline core::Ptr<RecognizedHolesInput> RecognizedFeaturesInput::holesInput() const
+{
+    core::Ptr<RecognizedHolesInput> res = holesInput_raw();
+    return res;
+}
+
+inline bool RecognizedFeaturesInput::holesInput(const core::Ptr<RecognizedHolesInput>& value)
+{
+    return holesInput_raw(value.get());
+}
+
+inline double RecognizedFeaturesInput::boundaryTolerance() const
+{
+    double res = boundaryTolerance_raw();
+    return res;
+}
+
+inline bool RecognizedFeaturesInput::boundaryTolerance(double value)
+{
+    return boundaryTolerance_raw(value);
+}
+
+inline int RecognizedFeaturesInput::maxConcurrency() const
+{
+    int res = maxConcurrency_raw();
+    return res;
+}
+
+inline bool RecognizedFeaturesInput::maxConcurrency(int value)
+{
+    return maxConcurrency_raw(value);
+}
+}// namespace cam
+}// namespace adsk
+
+#undef ADSK_CAM_RECOGNIZEDFEATURESINPUT_API
\ No newline at end of file
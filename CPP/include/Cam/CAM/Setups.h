@@ -12,6 +12,7 @@
 #include "../../Core/Base.h"
 #include "../CamTypeDefs.h"
 #include <string>
+#include <vector>
 
 // THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
 // THIS HEADER FILE WILL BE GENERATED FROM NIDL.
@@ -28,6 +29,8 @@
 #endif
 
 namespace adsk { namespace cam {
+    class CreateFromCAMTemplateInput;
+    class CreateFromCAMTemplateResults;
     class Setup;
     class SetupInput;
 }}
@@ -66,6 +69,20 @@ public:
     /// Returns newly created Setup instance.
     core::Ptr<Setup> add(const core::Ptr<SetupInput>& input);
 
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Creates new operations, folders, or patterns from the template of the input in many setups in one call. They are
+    /// added to the end of each setup. The template is parsed once and reused for all setups, and the geometry selections
+    /// of the template are resolved for the setups in parallel. A setup the template cannot be instantiated in does not
+    /// stop the others. When the generation mode of the input generates the operations, the generation of the operations
+    /// of all setups is started once they are all created.
+    /// input : Input object that contains the template to create from, the generation mode and the concurrency.
+    /// setups : The setups to instantiate the template in.
+    /// Returns the operations created in each setup and the errors, or null if the template could not be parsed.
+    core::Ptr<CreateFromCAMTemplateResults> createFromCAMTemplate(const core::Ptr<CreateFromCAMTemplateInput>& input, const std::vector<core::Ptr<Setup>>& setups);
+
     typedef Setup iterable_type;
     template <class OutputIterator> void copyTo(OutputIterator result);
 
@@ -83,6 +100,7 @@ private:
     virtual Setup* itemByOperationId_raw(int id) const = 0;
     virtual SetupInput* createInput_raw(OperationTypes type) = 0;
     virtual Setup* add_raw(SetupInput* input) = 0;
+    virtual CreateFromCAMTemplateResults* createFromCAMTemplate_raw(CreateFromCAMTemplateInput* input, Setup** setups, size_t setups_size) = 0;
 };
 
 // Inline wrappers
@@ -131,6 +149,17 @@ template <class OutputIterator> inline void Setups::copyTo(OutputIterator result
         ++result;
     }
 }
+
+inline core::Ptr<CreateFromCAMTemplateResults> Setups::createFromCAMTemplate(const core::Ptr<CreateFromCAMTemplateInput>& input, const std::vector<core::Ptr<Setup>>& setups)
+{
+    Setup** setups_ = new Setup*[setups.size()];
+    for(size_t i=0; i<setups.size(); ++i)
+        setups_[i] = setups[i].get();
+
+    core::Ptr<CreateFromCAMTemplateResults> res = createFromCAMTemplate_raw(input.get(), setups_, setups.size());
+    delete[] setups_;
+    return res;
+}
 }// namespace cam
 }// namespace adsk
 
@@ -0,0 +1,176 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "../../Core/Base.h"
+#include "../CamTypeDefs.h"
+
+// THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
+// THIS HEADER FILE WILL BE GENERATED FROM NIDL.
+#include "../../Core/OSMacros.h"
+
+#ifdef CAMXINTERFACE_EXPORTS
+# ifdef __COMPILING_ADSK_CAM_STOCKSIMULATIONINPUT_CPP__
+# define ADSK_CAM_STOCKSIMULATIONINPUT_API XI_EXPORT
+# else
+# define ADSK_CAM_STOCKSIMULATIONINPUT_API
+# endif
+#else
+# define ADSK_CAM_STOCKSIMULATIONINPUT_API XI_IMPORT
+#endif
+
+namespace adsk { namespace cam {
+
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// Defines the operations and the options for a stock simulation.
+/// Use the CAM.createStockSimulationInput method to create a new input object and pass it to
+/// the CAM.simulateStockRemoval method.
+/// The simulation starts from the stock of the parent setup of the first operation, as defined by its stock mode,
+/// and removes the material swept by the tool of each operation along its toolpath. The tool shape is taken from
+/// the parameters of the tool of the operation. The stock is represented by dexels, parallel lines of material
+/// along the tool orientation of the setup, so no user interface or graphics are needed.
+class StockSimulationInput : public core::Base {
+public:
+
+    /// Returns the Operation, Setup, Folder, or Pattern object or the ObjectCollection of these objects
+    /// the input was created for.
+    core::Ptr<core::Base> operations() const;
+
+    /// Gets and sets the spacing of the dexels in centimeters. Smaller values give more accurate deviations
+    /// at the cost of memory and time. 0 by default, which derives the spacing from the smallest tool of the operations.
+    double resolution() const;
+    bool resolution(double value);
+
+    /// Gets and sets the distance in centimeters the tool may cut into the model before a gouge is reported. 0.001 by default.
+    double gougeTolerance() const;
+    bool gougeTolerance(double value);
+
+    /// Gets and sets the minimum distance in centimeters between the stock and the tool holder or shank
+    /// before a collision is reported. 0 by default.
+    double holderClearance() const;
+    bool holderClearance(double value);
+
+    /// Gets and sets whether the deviation between the remaining stock and the model is calculated.
+    /// Leave this off if only the collisions are needed. True by default.
+    bool isDeviationIncluded() const;
+    bool isDeviationIncluded(bool value);
+
+    /// Gets and sets whether the simulation stops at the first collision. False by default.
+    bool isStoppingAtFirstCollision() const;
+    bool isStoppingAtFirstCollision(bool value);
+
+    /// Gets and sets the maximum number of threads used by the simulation.
+    /// 0 uses the number of processor cores. 0 by default.
+    int maxConcurrency() const;
+    bool maxConcurrency(int value);
+
+    ADSK_CAM_STOCKSIMULATIONINPUT_API static const char* classType();
+    ADSK_CAM_STOCKSIMULATIONINPUT_API const char* objectType() const override;
+    ADSK_CAM_STOCKSIMULATIONINPUT_API void* queryInterface(const char* id) const override;
+    ADSK_CAM_STOCKSIMULATIONINPUT_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual core::Base* operations_raw() const = 0;
+    virtual double resolution_raw() const = 0;
+    virtual bool resolution_raw(double value) = 0;
+    virtual double gougeTolerance_raw() const = 0;
+    virtual bool gougeTolerance_raw(double value) = 0;
+    virtual double holderClearance_raw() const = 0;
+    virtual bool holderClearance_raw(double value) = 0;
+    virtual bool isDeviationIncluded_raw() const = 0;
+    virtual bool isDeviationIncluded_raw(bool value) = 0;
+    virtual bool isStoppingAtFirstCollision_raw() const = 0;
+    virtual bool isStoppingAtFirstCollision_raw(bool value) = 0;
+    virtual int maxConcurrency_raw() const = 0;
+    virtual bool maxConcurrency_raw(int value) = 0;
+};
+
+// Inline wrappers
+
+inline core::Ptr<core::Base> StockSimulationInput::operations() const
+{
+    core::Ptr<core::Base> res = operations_raw();
+    return res;
+}
+
+inline double StockSimulationInput::resolution() const
+{
+    double res = resolution_raw();
+    return res;
+}
+
+inline bool StockSimulationInput::resolution(double value)
+{
+    return resolution_raw(value);
+}
+
+inline double StockSimulationInput::gougeTolerance() const
+{
+    double res = gougeTolerance_raw();
+    return res;
+}
+
+inline bool StockSimulationInput::gougeTolerance(double value)
+{
+    return gougeTolerance_raw(value);
+}
+
+inline double StockSimulationInput::holderClearance() const
+{
+    double res = holderClearance_raw();
+    return res;
+}
+
+inline bool StockSimulationInput::holderClearance(double value)
+{
+    return holderClearance_raw(value);
+}
+
+inline bool StockSimulationInput::isDeviationIncluded() const
+{
+    bool res = isDeviationIncluded_raw();
+    return res;
+}
+
+inline bool StockSimulationInput::isDeviationIncluded(bool value)
+{
+    return isDeviationIncluded_raw(value);
+}
+
+inline bool StockSimulationInput::isStoppingAtFirstCollision() const
+{
+    bool res = isStoppingAtFirstCollision_raw();
+    return res;
+}
+
+inline bool StockSimulationInput::isStoppingAtFirstCollision(bool value)
+{
+    return isStoppingAtFirstCollision_raw(value);
+}
+
+inline int StockSimulationInput::maxConcurrency() const
+{
+    int res = maxConcurrency_raw();
+    return res;
+}
+
+inline bool StockSimulationInput::maxConcurrency(int value)
+{
+    return maxConcurrency_raw(value);
+}
+}// namespace cam
+}// namespace adsk
+
+#undef ADSK_CAM_STOCKSIMULATIONINPUT_API
\ No newline at end of file
@@ -0,0 +1,299 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "../../Core/Base.h"
+#include "../CamTypeDefs.h"
+#include <vector>
+
+// THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
+// THIS HEADER FILE WILL BE GENERATED FROM NIDL.
+#include "../../Core/OSMacros.h"
+
+#ifdef CAMXINTERFACE_EXPORTS
+# ifdef __COMPILING_ADSK_CAM_STOCKSIMULATIONRESULT_CPP__
+# define ADSK_CAM_STOCKSIMULATIONRESULT_API XI_EXPORT
+# else
+# define ADSK_CAM_STOCKSIMULATIONRESULT_API
+# endif
+#else
+# define ADSK_CAM_STOCKSIMULATIONRESULT_API XI_IMPORT
+#endif
+
+namespace adsk { namespace cam {
+    class OperationBase;
+}}
+
+namespace adsk { namespace cam {
+
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// Object returned when using the simulateStockRemoval method from the CAM class.
+/// The deviation of the remaining stock from the model is sampled at points on the model surface.
+/// The deviation is positive where stock remains on the model and negative where the model was gouged.
+/// Collisions are identified by the index of the operation in the operations array and the index of the move,
+/// which is indexed the same way as the points of the ToolpathData of the operation: move i ends at point i.
+class StockSimulationResult : public core::Base {
+public:
+
+    /// Gets the operations that were simulated, in machining order.
+    std::vector<core::Ptr<OperationBase>> operations() const;
+
+    /// Gets the total number of moves simulated over all operations.
+    int moveCount() const;
+
+    /// Gets the time in seconds spent simulating.
+    double duration() const;
+
+    /// Returns false if the simulation stopped at the first collision before all operations were simulated.
+    bool isCompleted() const;
+
+    /// Gets the smallest deviation in centimeters. A negative value is the depth of the deepest gouge.
+    double minimumDeviation() const;
+
+    /// Gets the largest deviation in centimeters, which is the thickest remaining stock.
+    double maximumDeviation() const;
+
+    /// Gets the number of points the deviation is sampled at.
+    int deviationCount() const;
+
+    /// Gets the points on the model surface the deviation is sampled at as an array of doubles where they are the x, y, z
+    /// components of each point. The positions are in centimeters and defined in the world coordinate system of the setup.
+    /// startIndex : The index of the first point to return.
+    /// count : The number of points to return. Use -1 to return all points from startIndex to the end.
+    /// Returns an array of 3 * count values.
+    std::vector<double> deviationPositions(int startIndex = 0, int count = -1) const;
+
+    /// Gets the signed distance in centimeters from each sample point to the remaining stock, measured along the model normal.
+    /// startIndex : The index of the first point to return.
+    /// count : The number of points to return. Use -1 to return all points from startIndex to the end.
+    /// Returns an array of count values.
+    std::vector<double> deviations(int startIndex = 0, int count = -1) const;
+
+    /// Gets the number of collisions detected.
+    int collisionCount() const;
+
+    /// Gets the index into the operations array of the operation each collision occurred in.
+    /// startIndex : The index of the first collision to return.
+    /// count : The number of collisions to return. Use -1 to return all collisions from startIndex to the end.
+    /// Returns an array of count values.
+    std::vector<int> collisionOperationIndices(int startIndex = 0, int count = -1) const;
+
+    /// Gets the index of the move of the operation each collision occurred at.
+    /// startIndex : The index of the first collision to return.
+    /// count : The number of collisions to return. Use -1 to return all collisions from startIndex to the end.
+    /// Returns an array of count values.
+    std::vector<int> collisionMoveIndices(int startIndex = 0, int count = -1) const;
+
+    /// Gets the type of each collision. The values are obtained from the StockSimulationCollisionTypes enum
+    /// and returned as integers.
+    /// startIndex : The index of the first collision to return.
+    /// count : The number of collisions to return. Use -1 to return all collisions from startIndex to the end.
+    /// Returns an array of count values.
+    std::vector<int> collisionTypes(int startIndex = 0, int count = -1) const;
+
+    /// Gets the tool tip position at each collision as an array of doubles where they are the x, y, z components of each point.
+    /// startIndex : The index of the first collision to return.
+    /// count : The number of collisions to return. Use -1 to return all collisions from startIndex to the end.
+    /// Returns an array of 3 * count values.
+    std::vector<double> collisionPositions(int startIndex = 0, int count = -1) const;
+
+    /// Gets the largest depth in centimeters the tool, shank or holder penetrates the stock, model or fixture at each collision.
+    /// startIndex : The index of the first collision to return.
+    /// count : The number of collisions to return. Use -1 to return all collisions from startIndex to the end.
+    /// Returns an array of count values.
+    std::vector<double> collisionDepths(int startIndex = 0, int count = -1) const;
+
+    ADSK_CAM_STOCKSIMULATIONRESULT_API static const char* classType();
+    ADSK_CAM_STOCKSIMULATIONRESULT_API const char* objectType() const override;
+    ADSK_CAM_STOCKSIMULATIONRESULT_API void* queryInterface(const char* id) const override;
+    ADSK_CAM_STOCKSIMULATIONRESULT_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual OperationBase** operations_raw(size_t& return_size) const = 0;
+    virtual int moveCount_raw() const = 0;
+    virtual double duration_raw() const = 0;
+    virtual bool isCompleted_raw() const = 0;
+    virtual double minimumDeviation_raw() const = 0;
+    virtual double maximumDeviation_raw() const = 0;
+    virtual int deviationCount_raw() const = 0;
+    virtual double* deviationPositions_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual double* deviations_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual int collisionCount_raw() const = 0;
+    virtual int* collisionOperationIndices_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual int* collisionMoveIndices_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual int* collisionTypes_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual double* collisionPositions_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual double* collisionDepths_raw(int startIndex, int count, size_t& return_size) const = 0;
+};
+
+// Inline wrappers
+
+inline std::vector<core::Ptr<OperationBase>> StockSimulationResult::operations() const
+{
+    std::vector<core::Ptr<OperationBase>> res;
+    size_t s;
+
+    OperationBase** p= operations_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline int StockSimulationResult::moveCount() const
+{
+    int res = moveCount_raw();
+    return res;
+}
+
+inline double StockSimulationResult::duration() const
+{
+    double res = duration_raw();
+    return res;
+}
+
+inline bool StockSimulationResult::isCompleted() const
+{
+    bool res = isCompleted_raw();
+    return res;
+}
+
+inline double StockSimulationResult::minimumDeviation() const
+{
+    double res = minimumDeviation_raw();
+    return res;
+}
+
+inline double StockSimulationResult::maximumDeviation() const
+{
+    double res = maximumDeviation_raw();
+    return res;
+}
+
+inline int StockSimulationResult::deviationCount() const
+{
+    int res = deviationCount_raw();
+    return res;
+}
+
+inline std::vector<double> StockSimulationResult::deviationPositions(int startIndex, int count) const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= deviationPositions_raw(startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> StockSimulationResult::deviations(int startIndex, int count) const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= deviations_raw(startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline int StockSimulationResult::collisionCount() const
+{
+    int res = collisionCount_raw();
+    return res;
+}
+
+inline std::vector<int> StockSimulationResult::collisionOperationIndices(int startIndex, int count) const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= collisionOperationIndices_raw(startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<int> StockSimulationResult::collisionMoveIndices(int startIndex, int count) const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= collisionMoveIndices_raw(startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<int> StockSimulationResult::collisionTypes(int startIndex, int count) const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= collisionTypes_raw(startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> StockSimulationResult::collisionPositions(int startIndex, int count) const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= collisionPositions_raw(startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> StockSimulationResult::collisionDepths(int startIndex, int count) const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= collisionDepths_raw(startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+}// namespace cam
+}// namespace adsk
+
+#undef ADSK_CAM_STOCKSIMULATIONRESULT_API
\ No newline at end of file
@@ -0,0 +1,175 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "../../Core/Application/Events.h"
+#include "../../Core/Application/EventHandler.h"
+#include "../CamTypeDefs.h"
+#include <string>
+
+// THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
+// THIS HEADER FILE WILL BE GENERATED FROM NIDL.
+#include "../../Core/OSMacros.h"
+
+#ifdef CAMXINTERFACE_EXPORTS
+# ifdef __COMPILING_TOOLPATHGENERATEDEVENTS_CPP__
+# define TOOLPATHGENERATEDEVENTS_API XI_EXPORT
+# else
+# define TOOLPATHGENERATEDEVENTS_API
+# endif
+#else
+# define TOOLPATHGENERATEDEVENTS_API XI_IMPORT
+#endif
+
+namespace adsk { namespace cam {
+    class OperationBase;
+    class ToolpathGeneratedEventArgs;
+    class ToolpathGeneratedEventHandler;
+}}
+
+namespace adsk { namespace cam {
+
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// A ToolpathGeneratedEvent represents the completion of the generation of a single operation.
+/// It is used by the GenerateToolpathFuture.operationGenerated event.
+class ToolpathGeneratedEvent : public core::Event {
+public:
+
+    /// Add a handler to be notified when the event occurs.
+    /// handler : The handler object to be called when this event is fired.
+    /// Returns true if the addition of the handler was successful.
+    bool add(ToolpathGeneratedEventHandler* handler);
+
+    /// Removes a handler from the event.
+    /// handler : The handler object to be removed from the event.
+    /// Returns true if removal of the handler was successful.
+    bool remove(ToolpathGeneratedEventHandler* handler);
+
+    TOOLPATHGENERATEDEVENTS_API static const char* classType();
+    TOOLPATHGENERATEDEVENTS_API const char* objectType() const override;
+    TOOLPATHGENERATEDEVENTS_API void* queryInterface(const char* id) const override;
+    TOOLPATHGENERATEDEVENTS_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual bool add_raw(ToolpathGeneratedEventHandler* handler) = 0;
+    virtual bool remove_raw(ToolpathGeneratedEventHandler* handler) = 0;
+};
+
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// The ToolpathGeneratedEventArgs provides information about an operation whose generation has finished.
+class ToolpathGeneratedEventArgs : public core::EventArgs {
+public:
+
+    /// Returns the operation whose generation has finished.
+    core::Ptr<OperationBase> operation() const;
+
+    /// Returns the time in seconds that was spent generating the operation.
+    double duration() const;
+
+    /// Returns true if the toolpath was generated without errors.
+    bool isSuccess() const;
+
+    /// Returns the error message if the generation failed, or an empty string otherwise.
+    std::string error() const;
+
+    /// Returns the number of operations of the generation whose generation is complete, including this one.
+    int numberOfCompleted() const;
+
+    TOOLPATHGENERATEDEVENTS_API static const char* classType();
+    TOOLPATHGENERATEDEVENTS_API const char* objectType() const override;
+    TOOLPATHGENERATEDEVENTS_API void* queryInterface(const char* id) const override;
+    TOOLPATHGENERATEDEVENTS_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual OperationBase* operation_raw() const = 0;
+    virtual double duration_raw() const = 0;
+    virtual bool isSuccess_raw() const = 0;
+    virtual char* error_raw() const = 0;
+    virtual int numberOfCompleted_raw() const = 0;
+};
+
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// The ToolpathGeneratedEventHandler is a client implemented class that can be added as a handler to a
+/// ToolpathGeneratedEvent.
+class ToolpathGeneratedEventHandler : public core::EventHandler {
+public:
+
+    /// The function called by CAM when the associated event is fired.
+    /// eventArgs : Returns an object that provides access to additional information associated with the event.
+    TOOLPATHGENERATEDEVENTS_API virtual void notify(const core::Ptr<ToolpathGeneratedEventArgs>& eventArgs) = 0;
+};
+
+// Inline wrappers
+
+inline bool ToolpathGeneratedEvent::add(ToolpathGeneratedEventHandler* handler)
+{
+    bool res = add_raw(handler);
+    return res;
+}
+
+inline bool ToolpathGeneratedEvent::remove(ToolpathGeneratedEventHandler* handler)
+{
+    bool res = remove_raw(handler);
+    return res;
+}
+
+inline core::Ptr<OperationBase> ToolpathGeneratedEventArgs::operation() const
+{
+    core::Ptr<OperationBase> res = operation_raw();
+    return res;
+}
+
+inline double ToolpathGeneratedEventArgs::duration() const
+{
+    double res = duration_raw();
+    return res;
+}
+
+inline bool ToolpathGeneratedEventArgs::isSuccess() const
+{
+    bool res = isSuccess_raw();
+    return res;
+}
+
+inline std::string ToolpathGeneratedEventArgs::error() const
+{
+    std::string res;
+
+    char* p= error_raw();
+    if (p)
+    {
+        res = p;
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline int ToolpathGeneratedEventArgs::numberOfCompleted() const
+{
+    int res = numberOfCompleted_raw();
+    return res;
+}
+}// namespace cam
+}// namespace adsk
+
+#undef TOOLPATHGENERATEDEVENTS_API
\ No newline at end of file
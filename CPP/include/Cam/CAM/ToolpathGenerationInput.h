@@ -0,0 +1,136 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "../../Core/Base.h"
+#include "../CamTypeDefs.h"
+
+// THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
+// THIS HEADER FILE WILL BE GENERATED FROM NIDL.
+#include "../../Core/OSMacros.h"
+
+#ifdef CAMXINTERFACE_EXPORTS
+# ifdef __COMPILING_ADSK_CAM_TOOLPATHGENERATIONINPUT_CPP__
+# define ADSK_CAM_TOOLPATHGENERATIONINPUT_API XI_EXPORT
+# else
+# define ADSK_CAM_TOOLPATHGENERATIONINPUT_API
+# endif
+#else
+# define ADSK_CAM_TOOLPATHGENERATIONINPUT_API XI_IMPORT
+#endif
+
+namespace adsk { namespace cam {
+    class OperationBase;
+}}
+
+namespace adsk { namespace cam {
+
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// Defines the operations to generate and how the generation is scheduled.
+/// Use the CAM.createToolpathGenerationInput method to create a new input object and pass it to
+/// the CAM.generateToolpathWithInput method.
+/// Operations that depend on the result of other operations, like rest machining operations or operations
+/// using the rest stock of previous operations, are never started before the operations they depend on
+/// have been generated, regardless of their priority or the maximum concurrency.
+class ToolpathGenerationInput : public core::Base {
+public:
+
+    /// Returns the Operation, Setup, Folder, or Pattern object or the ObjectCollection of these objects
+    /// the input was created for.
+    core::Ptr<core::Base> operations() const;
+
+    /// Gets and sets the maximum number of operations that are generated at the same time.
+    /// 0 uses the number of parallel generations defined in the preferences. 0 by default.
+    int maxConcurrency() const;
+    bool maxConcurrency(int value);
+
+    /// Gets and sets whether operations that are already valid are skipped and only invalid operations are regenerated.
+    /// False by default.
+    bool isSkippingValidOperations() const;
+    bool isSkippingValidOperations(bool value);
+
+    /// Sets the priority of an operation. Whenever the generation of another operation can be started,
+    /// the operation with the highest priority whose dependencies are generated is started first.
+    /// Operations with the same priority are started in the order they appear in the browser.
+    /// operation : The operation to set the priority for. It must be one of the operations of this input.
+    /// priority : The priority of the operation. All operations have a priority of 0 by default.
+    /// Returns true if the priority was set successfully.
+    bool setPriority(const core::Ptr<OperationBase>& operation, int priority);
+
+    /// Gets the priority of an operation.
+    /// operation : The operation to get the priority for.
+    /// Returns the priority of the operation.
+    int priority(const core::Ptr<OperationBase>& operation) const;
+
+    ADSK_CAM_TOOLPATHGENERATIONINPUT_API static const char* classType();
+    ADSK_CAM_TOOLPATHGENERATIONINPUT_API const char* objectType() const override;
+    ADSK_CAM_TOOLPATHGENERATIONINPUT_API void* queryInterface(const char* id) const override;
+    ADSK_CAM_TOOLPATHGENERATIONINPUT_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual core::Base* operations_raw() const = 0;
+    virtual int maxConcurrency_raw() const = 0;
+    virtual bool maxConcurrency_raw(int value) = 0;
+    virtual bool isSkippingValidOperations_raw() const = 0;
+    virtual bool isSkippingValidOperations_raw(bool value) = 0;
+    virtual bool setPriority_raw(OperationBase* operation, int priority) = 0;
+    virtual int priority_raw(OperationBase* operation) const = 0;
+};
+
+// Inline wrappers
+
+inline core::Ptr<core::Base> ToolpathGenerationInput::operations() const
+{
+    core::Ptr<core::Base> res = operations_raw();
+    return res;
+}
+
+inline int ToolpathGenerationInput::maxConcurrency() const
+{
+    int res = maxConcurrency_raw();
+    return res;
+}
+
+inline bool ToolpathGenerationInput::maxConcurrency(int value)
+{
+    return maxConcurrency_raw(value);
+}
+
+inline bool ToolpathGenerationInput::isSkippingValidOperations() const
+{
+    bool res = isSkippingValidOperations_raw();
+    return res;
+}
+
+inline bool ToolpathGenerationInput::isSkippingValidOperations(bool value)
+{
+    return isSkippingValidOperations_raw(value);
+}
+
+inline bool ToolpathGenerationInput::setPriority(const core::Ptr<OperationBase>& operation, int priority)
+{
+    bool res = setPriority_raw(operation.get(), priority);
+    return res;
+}
+
+inline int ToolpathGenerationInput::priority(const core::Ptr<OperationBase>& operation) const
+{
+    int res = priority_raw(operation.get());
+    return res;
+}
+}// namespace cam
+}// namespace adsk
+
+#undef ADSK_CAM_TOOLPATHGENERATIONINPUT_API
\ No newline at end of file
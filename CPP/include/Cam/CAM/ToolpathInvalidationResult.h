@@ -0,0 +1,135 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "../../Core/Base.h"
+#include "../CamTypeDefs.h"
+#include <string>
+#include <vector>
+
+// THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
+// THIS HEADER FILE WILL BE GENERATED FROM NIDL.
+#include "../../Core/OSMacros.h"
+
+#ifdef CAMXINTERFACE_EXPORTS
+# ifdef __COMPILING_ADSK_CAM_TOOLPATHINVALIDATIONRESULT_CPP__
+# define ADSK_CAM_TOOLPATHINVALIDATIONRESULT_API XI_EXPORT
+# else
+# define ADSK_CAM_TOOLPATHINVALIDATIONRESULT_API
+# endif
+#else
+# define ADSK_CAM_TOOLPATHINVALIDATIONRESULT_API XI_IMPORT
+#endif
+
+namespace adsk { namespace cam {
+    class OperationBase;
+}}
+
+namespace adsk { namespace cam {
+
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// Describes whether the toolpath of a single operation is affected by the changes made to the design
+/// since the operation was generated and why.
+class ToolpathInvalidationResult : public core::Base {
+public:
+
+    /// Returns the operation this result is for.
+    core::Ptr<OperationBase> operation() const;
+
+    /// Returns true if the toolpath of the operation needs to be regenerated because at least one of its inputs has changed.
+    bool isAffected() const;
+
+    /// Returns the reasons why the operation needs to be regenerated. The values are obtained from the
+    /// ToolpathInvalidationReasons enum and returned as integers. The array is empty if the operation is not affected.
+    std::vector<int> reasons() const;
+
+    /// Returns the faces and bodies referenced by the operation whose entity token or revision id differs from the one
+    /// recorded when the operation was generated. Entities that no longer exist are not included.
+    std::vector<core::Ptr<core::Base>> changedEntities() const;
+
+    /// Returns a readable summary of the reasons, for instance to be written to a log.
+    std::string description() const;
+
+    ADSK_CAM_TOOLPATHINVALIDATIONRESULT_API static const char* classType();
+    ADSK_CAM_TOOLPATHINVALIDATIONRESULT_API const char* objectType() const override;
+    ADSK_CAM_TOOLPATHINVALIDATIONRESULT_API void* queryInterface(const char* id) const override;
+    ADSK_CAM_TOOLPATHINVALIDATIONRESULT_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual OperationBase* operation_raw() const = 0;
+    virtual bool isAffected_raw() const = 0;
+    virtual int* reasons_raw(size_t& return_size) const = 0;
+    virtual core::Base** changedEntities_raw(size_t& return_size) const = 0;
+    virtual char* description_raw() const = 0;
+};
+
+// Inline wrappers
+
+inline core::Ptr<OperationBase> ToolpathInvalidationResult::operation() const
+{
+    core::Ptr<OperationBase> res = operation_raw();
+    return res;
+}
+
+inline bool ToolpathInvalidationResult::isAffected() const
+{
+    bool res = isAffected_raw();
+    return res;
+}
+
+inline std::vector<int> ToolpathInvalidationResult::reasons() const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= reasons_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<core::Ptr<core::Base>> ToolpathInvalidationResult::changedEntities() const
+{
+    std::vector<core::Ptr<core::Base>> res;
+    size_t s;
+
+    core::Base** p= changedEntities_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::string ToolpathInvalidationResult::description() const
+{
+    std::string res;
+
+    char* p= description_raw();
+    if (p)
+    {
+        res = p;
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+}// namespace cam
+}// namespace adsk
+
+#undef ADSK_CAM_TOOLPATHINVALIDATIONRESULT_API
\ No newline at end of file
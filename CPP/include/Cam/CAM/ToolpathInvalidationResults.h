@@ -0,0 +1,101 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "../../Core/Base.h"
+#include "../CamTypeDefs.h"
+
+// THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
+// THIS HEADER FILE WILL BE GENERATED FROM NIDL.
+#include "../../Core/OSMacros.h"
+
+#ifdef CAMXINTERFACE_EXPORTS
+# ifdef __COMPILING_ADSK_CAM_TOOLPATHINVALIDATIONRESULTS_CPP__
+# define ADSK_CAM_TOOLPATHINVALIDATIONRESULTS_API XI_EXPORT
+# else
+# define ADSK_CAM_TOOLPATHINVALIDATIONRESULTS_API
+# endif
+#else
+# define ADSK_CAM_TOOLPATHINVALIDATIONRESULTS_API XI_IMPORT
+#endif
+
+namespace adsk { namespace cam {
+    class ToolpathInvalidationResult;
+}}
+
+namespace adsk { namespace cam {
+
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// Collection of ToolpathInvalidationResult objects, one for each operation that was checked.
+class ToolpathInvalidationResults : public core::Base {
+public:
+
+    /// Function that returns the specified result using an index into the collection.
+    /// index : The index of the item within the collection to return. The first item in the collection has an index of 0.
+    /// Returns the specified item or null if an invalid index was specified.
+    core::Ptr<ToolpathInvalidationResult> item(size_t index) const;
+
+    /// The number of items in the collection.
+    size_t count() const;
+
+    /// Returns the number of operations in the collection that need to be regenerated.
+    int affectedCount() const;
+
+    typedef ToolpathInvalidationResult iterable_type;
+    template <class OutputIterator> void copyTo(OutputIterator result);
+
+    ADSK_CAM_TOOLPATHINVALIDATIONRESULTS_API static const char* classType();
+    ADSK_CAM_TOOLPATHINVALIDATIONRESULTS_API const char* objectType() const override;
+    ADSK_CAM_TOOLPATHINVALIDATIONRESULTS_API void* queryInterface(const char* id) const override;
+    ADSK_CAM_TOOLPATHINVALIDATIONRESULTS_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual ToolpathInvalidationResult* item_raw(size_t index) const = 0;
+    virtual size_t count_raw() const = 0;
+    virtual int affectedCount_raw() const = 0;
+};
+
+// Inline wrappers
+
+inline core::Ptr<ToolpathInvalidationResult> ToolpathInvalidationResults::item(size_t index) const
+{
+    core::Ptr<ToolpathInvalidationResult> res = item_raw(index);
+    return res;
+}
+
+inline size_t ToolpathInvalidationResults::count() const
+{
+    size_t res = count_raw();
+    return res;
+}
+
+inline int ToolpathInvalidationResults::affectedCount() const
+{
+    int res = affectedCount_raw();
+    return res;
+}
+
+template <class OutputIterator> inline void ToolpathInvalidationResults::copyTo(OutputIterator result)
+{
+    for (size_t i = 0;i < count();++i)
+    {
+        *result = item(i);
+        ++result;
+    }
+}
+}// namespace cam
+}// namespace adsk
+
+#undef ADSK_CAM_TOOLPATHINVALIDATIONRESULTS_API
\ No newline at end of file
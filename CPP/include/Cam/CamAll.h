@@ -3,10 +3,15 @@
 #include <Cam/NCProgram/NCProgram.h>
 #include <Cam/NCProgram/NCPrograms.h>
 #include <Cam/NCProgram/NCProgramPostProcessOptions.h>
+#include <Cam/NCProgram/NCProgramPostProcessResult.h>
+#include <Cam/NCProgram/NCProgramPostProcessFuture.h>
 #include <Cam/GeneratedData/OptimizedOrientationResults.h>
 #include <Cam/GeneratedData/OptimizedOrientationResult.h>
 #include <Cam/GeneratedData/GeneratedDataCollection.h>
 #include <Cam/GeneratedData/GeneratedData.h>
+#include <Cam/GeneratedData/ToolpathData.h>
+#include <Cam/GeneratedData/OrientationScoringInput.h>
+#include <Cam/GeneratedData/OrientationScores.h>
 #include <Cam/MachineAvoidSelections/MachineAvoidSelectionBase.h>
 #include <Cam/MachineAvoidSelections/MachineAvoidDirectSelection.h>
 #include <Cam/MachineAvoidSelections/MachineAvoidDefaultSelection.h>
@@ -27,6 +32,7 @@
 #include <Cam/Tools/ToolQuery.h>
 #include <Cam/Tools/Tool.h>
 #include <Cam/Tools/ToolLibraries.h>
+#include <Cam/Tools/ToolIndex.h>
 #include <Cam/Post/PostLibrary.h>
 #include <Cam/Post/PostConfiguration.h>
 #include <Cam/Post/PostConfigurationQuery.h>
@@ -59,6 +65,8 @@
 #include <Cam/Operations/OperationInput.h>
 #include <Cam/Operations/Operation.h>
 #include <Cam/Operations/ChoiceParameterValue.h>
+#include <Cam/Operations/CAMParametersSnapshot.h>
+#include <Cam/Operations/CAMParametersDifference.h>
 #include <Cam/HoleRecognition/RecognizedHole.h>
 #include <Cam/HoleRecognition/RecognizedHoleGroup.h>
 #include <Cam/HoleRecognition/RecognizedHolesInput.h>
@@ -106,6 +114,19 @@
 #include <Cam/CAM/SetupInput.h>
 #include <Cam/CAM/Setups.h>
 #include <Cam/CAM/CAMHoleRecognition.h>
+#include <Cam/CAM/ToolpathGenerationInput.h>
+#include <Cam/CAM/ToolpathGeneratedEvents.h>
+#include <Cam/CAM/ToolpathInvalidationResult.h>
+#include <Cam/CAM/ToolpathInvalidationResults.h>
+#include <Cam/CAM/KinematicMachiningTimeInput.h>
+#include <Cam/CAM/KinematicMachiningTime.h>
+#include <Cam/CAM/StockSimulationInput.h>
+#include <Cam/CAM/StockSimulationResult.h>
+#include <Cam/CAM/RecognizedFeaturesInput.h>
+#include <Cam/CAM/RecognizedFeatures.h>
+#include <Cam/CAM/InspectionResultsData.h>
+#include <Cam/CAM/CreateFromCAMTemplateResults.h>
+#include <Cam/CAM/CAMBatchedChangeEvents.h>
 #include <Cam/Machine/MultiAxisInverseTimeFeedrateSettings.h>
 #include <Cam/Machine/KinematicsMachineElement.h>
 #include <Cam/Machine/LinearMachineAxisInput.h>
@@ -161,6 +182,8 @@
 #include <Cam/Machine/MultiAxisDPMFeedrateSettings.h>
 #include <Cam/Machine/AdditiveFFFLimitsMachineElement.h>
 #include <Cam/Machine/MachineElement.h>
+#include <Cam/Machine/MachineKinematicsSolver.h>
+#include <Cam/Machine/MachineKinematicsSolution.h>
 #include <Cam/GeometrySelections/FaceContourSelection.h>
 #include <Cam/GeometrySelections/PocketRecognitionSelection.h>
 #include <Cam/GeometrySelections/SketchSelection.h>
@@ -188,3 +211,4 @@
 #include <Cam/Global/CAMManager.h>
 #include <Cam/Global/NetworkMachineIntegrationInput.h>
 #include <Cam/Global/NetworkMachineEvents.h>
+#include <Cam/Global/CAMLibraryIndex.h>
@@ -181,6 +181,69 @@ enum CAMEventState
     CAMEventStateErrorOther = 8
 };
 
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// The types of library entries stored in a CAMLibraryIndex.
+enum CAMLibraryIndexEntryTypes
+{
+    /// Machines of the machine library.
+    MachineCAMLibraryIndexEntryType,
+    /// Post configurations of the post library.
+    PostConfigurationCAMLibraryIndexEntryType,
+    /// Print settings of the print setting library.
+    PrintSettingCAMLibraryIndexEntryType
+};
+
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// The types of the values of CAM parameters as reported by a CAMParametersSnapshot.
+enum CAMParameterValueTypes
+{
+    /// The value is a FloatParameterValue.
+    FloatCAMParameterValueType,
+    /// The value is an IntegerParameterValue.
+    IntegerCAMParameterValueType,
+    /// The value is a BooleanParameterValue.
+    BooleanCAMParameterValueType,
+    /// The value is a StringParameterValue.
+    StringCAMParameterValueType,
+    /// The value is a ChoiceParameterValue.
+    ChoiceCAMParameterValueType,
+    /// The value is of another type, like a geometry selection, and is only available through CAMParameter.value.
+    OtherCAMParameterValueType
+};
+
+/// The messages exchanged with a custom strategy worker over its standard input and output.
+/// Each message is a uint32 message type followed by a uint64 payload size in bytes and the payload. All values are little endian.
+/// For each operation, the host sends the parameters, model mesh, stock mesh and tool messages followed by the end of input message.
+/// The worker streams moves and progress messages and finishes with an end of output or an error message.
+/// A worker process is reused for the next operation after the end of output message.
+enum CustomStrategyWorkerMessageTypes
+{
+    /// Host to worker. The parameters of the operation as UTF-8 XML, in the format of the strategy definition.
+    ParametersCustomStrategyWorkerMessageType = 1,
+    /// Host to worker. The machining model as a triangle mesh: a uint32 triangle count followed by 9 float64 vertex coordinates in cm for each triangle.
+    ModelMeshCustomStrategyWorkerMessageType = 2,
+    /// Host to worker. The stock as a triangle mesh, in the same layout as the model mesh.
+    StockMeshCustomStrategyWorkerMessageType = 3,
+    /// Host to worker. The tool of the operation as UTF-8 JSON, in the format of the tool libraries.
+    ToolCustomStrategyWorkerMessageType = 4,
+    /// Host to worker. No more input follows for this operation. The payload is empty.
+    EndOfInputCustomStrategyWorkerMessageType = 5,
+    /// Worker to host. A block of toolpath moves: a uint32 move count followed, for each move, by a uint8 move type from the ToolpathMoveTypes enum, 3 float64 position coordinates in cm, 3 float64 tool axis components and a float64 feedrate in cm/s.
+    MovesCustomStrategyWorkerMessageType = 16,
+    /// Worker to host. A float64 from 0 to 1 with the progress of the computation.
+    ProgressCustomStrategyWorkerMessageType = 17,
+    /// Worker to host. A UTF-8 error message. The generation of the operation fails.
+    ErrorCustomStrategyWorkerMessageType = 18,
+    /// Worker to host. The toolpath is complete. The payload is empty.
+    EndOfOutputCustomStrategyWorkerMessageType = 19
+};
+
 /// Types of default groups. Used to specify which default group to be retrieved by defaultGroup method.
 enum DefaultGroupType
 {
@@ -267,7 +330,9 @@ enum FusionHubExecutionBehaviors
 enum GeneratedDataType
 {
     /// Optimized orientation identifier
-    OptimizedOrientationGeneratedDataType
+    OptimizedOrientationGeneratedDataType,
+    /// Toolpath identifier
+    ToolpathGeneratedDataType
 };
 
 /// Represents the recognized geometric shape of a hole segment.
@@ -412,6 +477,23 @@ enum MachineItemType
     MachineItemType_INVALID
 };
 
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// The types of issues reported by a MachineKinematicsSolver.
+enum MachineKinematicsIssueTypes
+{
+    /// The tool axis cannot be reached by any combination of the rotary axes.
+    UnreachableMachineKinematicsIssueType,
+    /// The value of an axis is outside its physical range.
+    AxisLimitMachineKinematicsIssueType,
+    /// The tool axis is closer to a singularity than the singularity cone of the solver.
+    SingularityMachineKinematicsIssueType,
+    /// A rotary axis has to turn back by a full revolution or jump to the other solution to stay within its range.
+    RotaryUnwindMachineKinematicsIssueType
+};
+
 /// Interpolation modes available for non-TCP motions.
 enum MachineNonTCPInterpolationMode
 {
@@ -502,6 +584,27 @@ enum MachiningMode
     Fixture_MachiningMode
 };
 
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// The factors limiting the speed of a move in a kinematic machining time estimate.
+enum MachiningTimeLimitingFactors
+{
+    /// The move runs at the programmed feedrate, or the rapid speed for rapid moves.
+    ProgrammedFeedrateLimitingFactor,
+    /// The speed is limited by the maximum speed of an axis.
+    AxisSpeedLimitingFactor,
+    /// The speed is limited by the maximum acceleration of an axis.
+    AxisAccelerationLimitingFactor,
+    /// The speed is limited by the maximum jerk of an axis.
+    AxisJerkLimitingFactor,
+    /// The speed is limited by the maximum block processing speed of the controller.
+    BlockProcessingLimitingFactor,
+    /// The speed is limited by the look-ahead of the controller, which must slow down to stop within the blocks it has planned ahead.
+    LookAheadLimitingFactor
+};
+
 /// Types of provided ModifyUtility.
 enum ModifyUtilityTypes
 {
@@ -857,6 +960,25 @@ enum SplitSupportTypes
     SolidOpenSeparateSplitSupportType
 };
 
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// The types of collisions detected by a stock simulation.
+enum StockSimulationCollisionTypes
+{
+    /// A rapid move cuts into the stock.
+    RapidStockSimulationCollisionType,
+    /// The non-cutting part of the tool above the flutes touches the stock.
+    ShankStockSimulationCollisionType,
+    /// The tool holder touches the stock.
+    HolderStockSimulationCollisionType,
+    /// The tool or the tool holder touches a fixture of the setup.
+    FixtureStockSimulationCollisionType,
+    /// The tool cuts into the model by more than the gouge tolerance.
+    GougeStockSimulationCollisionType
+};
+
 /// The custom strategy command definitions to specify the entry points in the UI.
 enum StrategyRegistrationIssues
 {
@@ -872,5 +994,83 @@ enum StrategyRegistrationIssues
     CancelOnAll_StrategyRegistrationIssues
 };
 
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// The numeric fields of the tools stored in a ToolIndex.
+enum ToolIndexFields
+{
+    /// The cutting diameter of the tool.
+    DiameterToolIndexField,
+    /// The flute length of the tool.
+    FluteLengthToolIndexField,
+    /// The corner radius of the tool.
+    CornerRadiusToolIndexField,
+    /// The overall length of the tool.
+    OverallLengthToolIndexField,
+    /// The shaft diameter of the tool.
+    ShaftDiameterToolIndexField,
+    /// The number of flutes of the tool.
+    NumberOfFlutesToolIndexField
+};
+
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// The reasons why the toolpath of an operation needs to be regenerated.
+enum ToolpathInvalidationReasons
+{
+    /// A face, edge or sketch referenced by a geometry selection of the operation has changed.
+    GeometrySelectionChangedInvalidationReason,
+    /// A body of the model of the setup that the toolpath is calculated against has changed.
+    ModelChangedInvalidationReason,
+    /// The stock of the setup or a body the stock is derived from has changed.
+    StockChangedInvalidationReason,
+    /// An entity referenced by the operation no longer exists.
+    MissingReferenceInvalidationReason,
+    /// An operation this operation depends on, for instance as rest machining source, needs to be regenerated.
+    DependencyInvalidationReason,
+    /// A parameter or the tool of the operation has changed since it was generated.
+    ParameterChangedInvalidationReason
+};
+
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// The types of moves in the toolpath of an operation.
+enum ToolpathMoveTypes
+{
+    /// Rapid move with the rapid feedrate of the machine.
+    RapidToolpathMoveType,
+    /// Lead-in move approaching the material.
+    LeadInToolpathMoveType,
+    /// Lead-out move leaving the material.
+    LeadOutToolpathMoveType,
+    /// Cutting move in the material.
+    CuttingToolpathMoveType,
+    /// Linking move between two cutting passes at a programmed feedrate.
+    LinkingToolpathMoveType,
+    /// Plunge move along the tool axis.
+    PlungeToolpathMoveType
+};
+
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// The types of segments in the toolpath of an operation.
+enum ToolpathSegmentTypes
+{
+    /// The points of the segment are connected by straight lines.
+    LinearToolpathSegmentType,
+    /// The points of the segment lie on a planar circular arc.
+    CircularToolpathSegmentType,
+    /// The points of the segment lie on a helix around the arc normal.
+    HelicalToolpathSegmentType
+};
+
 }// namespace cam
 }// namespace adsk
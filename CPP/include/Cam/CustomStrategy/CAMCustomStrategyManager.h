@@ -31,6 +31,7 @@
 namespace adsk { namespace cam {
     class CustomOperationDefinitionInput;
     class CustomOperationRegistrationResult;
+    class OperationBase;
 }}
 
 namespace adsk { namespace cam {
@@ -73,6 +74,17 @@ public:
     /// False if any strategy registered with the addin could not be deregistered.
     bool deregisterCustomOperationsByAddinName(const std::string& addinName);
 
+    /// Writes the messages the host would send to the worker of a custom operation to a file, in the binary format described
+    /// by the CustomStrategyWorkerMessageTypes enum. Piping the file into the worker executable reproduces the computation
+    /// without Fusion, for instance to debug or benchmark the worker offline on another platform.
+    /// operation : The custom operation whose inputs are exported.
+    /// filePath : The full path of the file to write.
+    /// True if the inputs were exported.
+    bool exportWorkerInput(const core::Ptr<OperationBase>& operation, const std::string& filePath);
+
+    /// Returns the number of worker processes currently computing an operation.
+    int runningWorkerCount() const;
+
     ADSK_CAM_CAMCUSTOMSTRATEGYMANAGER_API static const char* classType();
     ADSK_CAM_CAMCUSTOMSTRATEGYMANAGER_API const char* objectType() const override;
     ADSK_CAM_CAMCUSTOMSTRATEGYMANAGER_API void* queryInterface(const char* id) const override;
@@ -85,6 +97,8 @@ private:
     virtual CustomOperationRegistrationResult** registerCustomOperations_raw(CustomOperationDefinitionInput** inputs, size_t inputs_size, size_t& return_size) = 0;
     virtual bool deregisterCustomOperationByStrategyName_raw(const char* strategyName) = 0;
     virtual bool deregisterCustomOperationsByAddinName_raw(const char* addinName) = 0;
+    virtual bool exportWorkerInput_raw(OperationBase* operation, const char* filePath) = 0;
+    virtual int runningWorkerCount_raw() const = 0;
 };
 
 // Inline wrappers
@@ -124,6 +138,18 @@ inline bool CAMCustomStrategyManager::deregisterCustomOperationsByAddinName(cons
     bool res = deregisterCustomOperationsByAddinName_raw(addinName.c_str());
     return res;
 }
+
+inline bool CAMCustomStrategyManager::exportWorkerInput(const core::Ptr<OperationBase>& operation, const std::string& filePath)
+{
+    bool res = exportWorkerInput_raw(operation.get(), filePath.c_str());
+    return res;
+}
+
+inline int CAMCustomStrategyManager::runningWorkerCount() const
+{
+    int res = runningWorkerCount_raw();
+    return res;
+}
 }// namespace cam
 }// namespace adsk
 
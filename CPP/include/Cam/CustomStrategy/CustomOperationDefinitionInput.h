@@ -85,6 +85,24 @@ public:
     std::vector<core::Ptr<StrategyCommandDefinition>> strategyCommandDefinitions() const;
     bool strategyCommandDefinitions(const std::vector<core::Ptr<StrategyCommandDefinition>>& value);
 
+    /// Path to an executable that computes the toolpaths of the strategy in a separate worker process.
+    /// Fusion starts the worker, sends it the inputs of each operation to generate and reads the toolpath moves back as described by
+    /// the CustomStrategyWorkerMessageTypes enum, so the computation neither blocks Fusion nor runs on a single thread.
+    /// If left empty, no worker is started and the operations are computed in-process as before, through kernelPath or the
+    /// generationStarted event; workerArguments and maxWorkerCount are then ignored.
+    /// The given path must be absolute.
+    std::string workerPath() const;
+    bool workerPath(const std::string& value);
+
+    /// The command line arguments passed to the worker executable. Empty by default.
+    std::vector<std::string> workerArguments() const;
+    bool workerArguments(const std::vector<std::string>& value);
+
+    /// The maximum number of worker processes, and therefore of operations of the strategy generated at the same time.
+    /// 0 uses the number of processor cores. By default the value is 0.
+    int maxWorkerCount() const;
+    bool maxWorkerCount(int value);
+
     ADSK_CAM_CUSTOMOPERATIONDEFINITIONINPUT_API static const char* classType();
     ADSK_CAM_CUSTOMOPERATIONDEFINITIONINPUT_API const char* objectType() const override;
     ADSK_CAM_CUSTOMOPERATIONDEFINITIONINPUT_API void* queryInterface(const char* id) const override;
@@ -108,6 +126,12 @@ private:
     virtual bool strategyRegistrationIssues_raw(StrategyRegistrationIssues value) = 0;
     virtual StrategyCommandDefinition** strategyCommandDefinitions_raw(size_t& return_size) const = 0;
     virtual bool strategyCommandDefinitions_raw(StrategyCommandDefinition** value, size_t value_size) = 0;
+    virtual char* workerPath_raw() const = 0;
+    virtual bool workerPath_raw(const char* value) = 0;
+    virtual char** workerArguments_raw(size_t& return_size) const = 0;
+    virtual bool workerArguments_raw(const char** value, size_t value_size) = 0;
+    virtual int maxWorkerCount_raw() const = 0;
+    virtual bool maxWorkerCount_raw(int value) = 0;
 };
 
 // Inline wrappers
@@ -236,6 +260,69 @@ inline bool CustomOperationDefinitionInput::strategyCommandDefinitions(const std
     delete[] value_;
     return res;
 }
+
+inline std::string CustomOperationDefinitionInput::workerPath() const
+{
+    std::string res;
+
+    char* p= workerPath_raw();
+    if (p)
+    {
+        res = p;
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline bool CustomOperationDefinitionInput::workerPath(const std::string& value)
+{
+    return workerPath_raw(value.c_str());
+}
+
+inline std::vector<std::string> CustomOperationDefinitionInput::workerArguments() const
+{
+    std::vector<std::string> res;
+    size_t s;
+
+    char** p= workerArguments_raw(s);
+    if(p)
+    {
+        res.resize(s);
+        for(size_t i=0; i<s; ++i)
+        {
+            char* pChar = p[i];
+            if(pChar)
+                res[i] = pChar;
+            core::DeallocateArray(pChar);
+        }
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline bool CustomOperationDefinitionInput::workerArguments(const std::vector<std::string>& value)
+{
+    const char** value_ = value.empty() ? nullptr : (new const char*[value.size()]);
+    for(size_t i = 0; i < value.size(); ++i)
+    {
+        value_[i] = value[i].c_str();
+    }
+
+    bool res = workerArguments_raw(value_, value.size());
+    delete[] value_;
+    return res;
+}
+
+inline int CustomOperationDefinitionInput::maxWorkerCount() const
+{
+    int res = maxWorkerCount_raw();
+    return res;
+}
+
+inline bool CustomOperationDefinitionInput::maxWorkerCount(int value)
+{
+    return maxWorkerCount_raw(value);
+}
 }// namespace cam
 }// namespace adsk
 
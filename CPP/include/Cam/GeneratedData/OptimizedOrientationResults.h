@@ -27,6 +27,8 @@
 
 namespace adsk { namespace cam {
     class OptimizedOrientationResult;
+    class OrientationScores;
+    class OrientationScoringInput;
 }}
 
 namespace adsk { namespace cam {
@@ -52,6 +54,25 @@ public:
     /// The number of items in the collection.
     size_t count() const;
 
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Creates a new OrientationScoringInput object with the settings of the parent orientation operation
+    /// to be used with the scoreOrientations method.
+    /// Returns the newly created input object.
+    core::Ptr<OrientationScoringInput> createScoringInput();
+
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Scores many candidate orientations of the part of the parent orientation operation. The part is tessellated once and
+    /// the orientations are scored in parallel.
+    /// input : The OrientationScoringInput object that defines the orientations and the weights.
+    /// Returns the scores or null if the scoring failed.
+    core::Ptr<OrientationScores> scoreOrientations(const core::Ptr<OrientationScoringInput>& input);
+
     typedef OptimizedOrientationResult iterable_type;
     template <class OutputIterator> void copyTo(OutputIterator result);
 
@@ -68,6 +89,8 @@ private:
     virtual OptimizedOrientationResult* currentOrientationResult_raw() const = 0;
     virtual bool currentOrientationResult_raw(OptimizedOrientationResult* value) = 0;
     virtual size_t count_raw() const = 0;
+    virtual OrientationScoringInput* createScoringInput_raw() = 0;
+    virtual OrientationScores* scoreOrientations_raw(OrientationScoringInput* input) = 0;
 };
 
 // Inline wrappers
@@ -109,6 +132,18 @@ template <class OutputIterator> inline void OptimizedOrientationResults::copyTo(
         ++result;
     }
 }
+
+inline core::Ptr<OrientationScoringInput> OptimizedOrientationResults::createScoringInput()
+{
+    core::Ptr<OrientationScoringInput> res = createScoringInput_raw();
+    return res;
+}
+
+inline core::Ptr<OrientationScores> OptimizedOrientationResults::scoreOrientations(const core::Ptr<OrientationScoringInput>& input)
+{
+    core::Ptr<OrientationScores> res = scoreOrientations_raw(input.get());
+    return res;
+}
 }// namespace cam
 }// namespace adsk
 
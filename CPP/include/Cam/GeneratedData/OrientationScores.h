@@ -0,0 +1,238 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "../../Core/Base.h"
+#include "../CamTypeDefs.h"
+#include <vector>
+
+// THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
+// THIS HEADER FILE WILL BE GENERATED FROM NIDL.
+#include "../../Core/OSMacros.h"
+
+#ifdef CAMXINTERFACE_EXPORTS
+# ifdef __COMPILING_ADSK_CAM_ORIENTATIONSCORES_CPP__
+# define ADSK_CAM_ORIENTATIONSCORES_API XI_EXPORT
+# else
+# define ADSK_CAM_ORIENTATIONSCORES_API
+# endif
+#else
+# define ADSK_CAM_ORIENTATIONSCORES_API XI_IMPORT
+#endif
+
+namespace adsk { namespace cam {
+    class OptimizedOrientationResult;
+}}
+
+namespace adsk { namespace cam {
+
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// Object returned when using the scoreOrientations method from the OptimizedOrientationResults class.
+/// The measures of all scored orientations are available as parallel arrays. Each measure is normalized by its range over
+/// all orientations before it is weighted, and the objective value is the sum of the weighted measures, so lower is better.
+class OrientationScores : public core::Base {
+public:
+
+    /// Returns the number of scored orientations.
+    int count() const;
+
+    /// Returns the time in seconds spent scoring the orientations.
+    double duration() const;
+
+    /// Returns the scored orientations as an array of doubles where they are the x, y, z components of each direction.
+    std::vector<double> directions() const;
+
+    /// Returns the area in square centimeters of the triangles needing support. The array has one entry for each scored orientation.
+    std::vector<double> overhangAreas() const;
+
+    /// Returns the volume in cubic centimeters between the overhanging triangles and the build plate or the part below. The array has one entry for each scored orientation.
+    std::vector<double> supportVolumes() const;
+
+    /// Returns the area in square centimeters of the projection of the part onto the build plate. The array has one entry for each scored orientation.
+    std::vector<double> footprintAreas() const;
+
+    /// Returns the height in centimeters of the oriented part. The array has one entry for each scored orientation.
+    std::vector<double> buildHeights() const;
+
+    /// Returns the height in centimeters of the center of gravity of the oriented part. The array has one entry for each scored orientation.
+    std::vector<double> centerOfGravityHeights() const;
+
+    /// Returns the weighted objective value. The array has one entry for each scored orientation.
+    std::vector<double> objectiveValues() const;
+
+    /// Returns the indices of the orientations ordered by their objective value, best first.
+    std::vector<int> rankedIndices() const;
+
+    /// Creates an orientation result for a scored orientation. Set the result as the currentOrientationResult of the
+    /// OptimizedOrientationResults the scores were calculated for to apply the orientation to the occurrence.
+    /// The rotation about the build direction is chosen to minimize the bounding box volume.
+    /// index : The index of the orientation.
+    /// Returns the orientation result or null if the index is invalid.
+    core::Ptr<OptimizedOrientationResult> createResult(int index);
+
+    ADSK_CAM_ORIENTATIONSCORES_API static const char* classType();
+    ADSK_CAM_ORIENTATIONSCORES_API const char* objectType() const override;
+    ADSK_CAM_ORIENTATIONSCORES_API void* queryInterface(const char* id) const override;
+    ADSK_CAM_ORIENTATIONSCORES_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual int count_raw() const = 0;
+    virtual double duration_raw() const = 0;
+    virtual double* directions_raw(size_t& return_size) const = 0;
+    virtual double* overhangAreas_raw(size_t& return_size) const = 0;
+    virtual double* supportVolumes_raw(size_t& return_size) const = 0;
+    virtual double* footprintAreas_raw(size_t& return_size) const = 0;
+    virtual double* buildHeights_raw(size_t& return_size) const = 0;
+    virtual double* centerOfGravityHeights_raw(size_t& return_size) const = 0;
+    virtual double* objectiveValues_raw(size_t& return_size) const = 0;
+    virtual int* rankedIndices_raw(size_t& return_size) const = 0;
+    virtual OptimizedOrientationResult* createResult_raw(int index) = 0;
+};
+
+// Inline wrappers
+
+inline int OrientationScores::count() const
+{
+    int res = count_raw();
+    return res;
+}
+
+inline double OrientationScores::duration() const
+{
+    double res = duration_raw();
+    return res;
+}
+
+inline std::vector<double> OrientationScores::directions() const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= directions_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> OrientationScores::overhangAreas() const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= overhangAreas_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> OrientationScores::supportVolumes() const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= supportVolumes_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> OrientationScores::footprintAreas() const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= footprintAreas_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> OrientationScores::buildHeights() const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= buildHeights_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> OrientationScores::centerOfGravityHeights() const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= centerOfGravityHeights_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> OrientationScores::objectiveValues() const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= objectiveValues_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<int> OrientationScores::rankedIndices() const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= rankedIndices_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline core::Ptr<OptimizedOrientationResult> OrientationScores::createResult(int index)
+{
+    core::Ptr<OptimizedOrientationResult> res = createResult_raw(index);
+    return res;
+}
+}// namespace cam
+}// namespace adsk
+
+#undef ADSK_CAM_ORIENTATIONSCORES_API
\ No newline at end of file
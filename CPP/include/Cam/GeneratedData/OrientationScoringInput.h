@@ -0,0 +1,221 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "../../Core/Base.h"
+#include "../CamTypeDefs.h"
+#include <vector>
+
+// THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
+// THIS HEADER FILE WILL BE GENERATED FROM NIDL.
+#include "../../Core/OSMacros.h"
+
+#ifdef CAMXINTERFACE_EXPORTS
+# ifdef __COMPILING_ADSK_CAM_ORIENTATIONSCORINGINPUT_CPP__
+# define ADSK_CAM_ORIENTATIONSCORINGINPUT_API XI_EXPORT
+# else
+# define ADSK_CAM_ORIENTATIONSCORINGINPUT_API
+# endif
+#else
+# define ADSK_CAM_ORIENTATIONSCORINGINPUT_API XI_IMPORT
+#endif
+
+namespace adsk { namespace cam {
+
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// Defines the candidate orientations and the weights used by OptimizedOrientationResults.scoreOrientations.
+/// Use the OptimizedOrientationResults.createScoringInput method to create a new input object.
+/// Orientations are described by the direction of the part, in the coordinate system of the occurrence at the time of the
+/// calculation, that points up along the build direction after the part is oriented.
+class OrientationScoringInput : public core::Base {
+public:
+
+    /// Gets and sets the number of orientations sampled evenly over the unit sphere. Ignored if directions is not empty. 1000 by default.
+    int sampleCount() const;
+    bool sampleCount(int value);
+
+    /// Gets and sets the orientations to score as an array of doubles where they are the x, y, z components of each direction.
+    /// Empty by default, which samples sampleCount directions over the unit sphere.
+    std::vector<double> directions() const;
+    bool directions(const std::vector<double>& value);
+
+    /// Gets and sets the angle in radians between a downward facing triangle and the build plate below which the triangle needs support.
+    /// Defaults to the overhang angle of the parent orientation operation.
+    double overhangAngle() const;
+    bool overhangAngle(double value);
+
+    /// Gets and sets the weight of the overhang area in the objective value. 1 by default.
+    double overhangAreaWeight() const;
+    bool overhangAreaWeight(double value);
+
+    /// Gets and sets the weight of the support volume in the objective value. 1 by default.
+    double supportVolumeWeight() const;
+    bool supportVolumeWeight(double value);
+
+    /// Gets and sets the weight of the footprint area on the build plate in the objective value. 0 by default.
+    double footprintAreaWeight() const;
+    bool footprintAreaWeight(double value);
+
+    /// Gets and sets the weight of the build height in the objective value. 1 by default.
+    double buildHeightWeight() const;
+    bool buildHeightWeight(double value);
+
+    /// Gets and sets the weight of the height of the center of gravity in the objective value. 0 by default.
+    double centerOfGravityHeightWeight() const;
+    bool centerOfGravityHeightWeight(double value);
+
+    /// Gets and sets the maximum number of threads used to score the orientations.
+    /// 0 uses the number of processor cores. 0 by default.
+    int maxConcurrency() const;
+    bool maxConcurrency(int value);
+
+    ADSK_CAM_ORIENTATIONSCORINGINPUT_API static const char* classType();
+    ADSK_CAM_ORIENTATIONSCORINGINPUT_API const char* objectType() const override;
+    ADSK_CAM_ORIENTATIONSCORINGINPUT_API void* queryInterface(const char* id) const override;
+    ADSK_CAM_ORIENTATIONSCORINGINPUT_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual int sampleCount_raw() const = 0;
+    virtual bool sampleCount_raw(int value) = 0;
+    virtual double* directions_raw(size_t& return_size) const = 0;
+    virtual bool directions_raw(const double* value, size_t value_size) = 0;
+    virtual double overhangAngle_raw() const = 0;
+    virtual bool overhangAngle_raw(double value) = 0;
+    virtual double overhangAreaWeight_raw() const = 0;
+    virtual bool overhangAreaWeight_raw(double value) = 0;
+    virtual double supportVolumeWeight_raw() const = 0;
+    virtual bool supportVolumeWeight_raw(double value) = 0;
+    virtual double footprintAreaWeight_raw() const = 0;
+    virtual bool footprintAreaWeight_raw(double value) = 0;
+    virtual double buildHeightWeight_raw() const = 0;
+    virtual bool buildHeightWeight_raw(double value) = 0;
+    virtual double centerOfGravityHeightWeight_raw() const = 0;
+    virtual bool centerOfGravityHeightWeight_raw(double value) = 0;
+    virtual int maxConcurrency_raw() const = 0;
+    virtual bool maxConcurrency_raw(int value) = 0;
+};
+
+// Inline wrappers
+
+inline int OrientationScoringInput::sampleCount() const
+{
+    int res = sampleCount_raw();
+    return res;
+}
+
+inline bool OrientationScoringInput::sampleCount(int value)
+{
+    return sampleCount_raw(value);
+}
+
+inline std::vector<double> OrientationScoringInput::directions() const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= directions_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline bool OrientationScoringInput::directions(const std::vector<double>& value)
+{
+    return directions_raw(value.empty() ? nullptr : &value[0], value.size());
+}
+
+inline double OrientationScoringInput::overhangAngle() const
+{
+    double res = overhangAngle_raw();
+    return res;
+}
+
+inline bool OrientationScoringInput::overhangAngle(double value)
+{
+    return overhangAngle_raw(value);
+}
+
+inline double OrientationScoringInput::overhangAreaWeight() const
+{
+    double res = overhangAreaWeight_raw();
+    return res;
+}
+
+inline bool OrientationScoringInput::overhangAreaWeight(double value)
+{
+    return overhangAreaWeight_raw(value);
+}
+
+inline double OrientationScoringInput::supportVolumeWeight() const
+{
+    double res = supportVolumeWeight_raw();
+    return res;
+}
+
+inline bool OrientationScoringInput::supportVolumeWeight(double value)
+{
+    return supportVolumeWeight_raw(value);
+}
+
+inline double OrientationScoringInput::footprintAreaWeight() const
+{
+    double res = footprintAreaWeight_raw();
+    return res;
+}
+
+inline bool OrientationScoringInput::footprintAreaWeight(double value)
+{
+    return footprintAreaWeight_raw(value);
+}
+
+inline double OrientationScoringInput::buildHeightWeight() const
+{
+    double res = buildHeightWeight_raw();
+    return res;
+}
+
+inline bool OrientationScoringInput::buildHeightWeight(double value)
+{
+    return buildHeightWeight_raw(value);
+}
+
+inline double OrientationScoringInput::centerOfGravityHeightWeight() const
+{
+    double res = centerOfGravityHeightWeight_raw();
+    return res;
+}
+
+inline bool OrientationScoringInput::centerOfGravityHeightWeight(double value)
+{
+    return centerOfGravityHeightWeight_raw(value);
+}
+
+inline int OrientationScoringInput::maxConcurrency() const
+{
+    int res = maxConcurrency_raw();
+    return res;
+}
+
+inline bool OrientationScoringInput::maxConcurrency(int value)
+{
+    return maxConcurrency_raw(value);
+}
+}// namespace cam
+}// namespace adsk
+
+#undef ADSK_CAM_ORIENTATIONSCORINGINPUT_API
\ No newline at end of file
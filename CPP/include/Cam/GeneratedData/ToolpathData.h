@@ -0,0 +1,255 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "GeneratedData.h"
+#include <vector>
+
+// THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
+// THIS HEADER FILE WILL BE GENERATED FROM NIDL.
+#include "../../Core/OSMacros.h"
+
+#ifdef CAMXINTERFACE_EXPORTS
+# ifdef __COMPILING_ADSK_CAM_TOOLPATHDATA_CPP__
+# define ADSK_CAM_TOOLPATHDATA_API XI_EXPORT
+# else
+# define ADSK_CAM_TOOLPATHDATA_API
+# endif
+#else
+# define ADSK_CAM_TOOLPATHDATA_API XI_IMPORT
+#endif
+
+namespace adsk { namespace cam {
+
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// The toolpath of a generated operation, exposed as flat arrays instead of individual objects.
+/// Every point of the toolpath has a position, a tool axis, a feedrate and a move type, each available
+/// as its own contiguous array. Consecutive points are grouped into segments that describe whether the
+/// points are connected by lines or arcs.
+/// All arrays can be read in chunks by specifying a start index and a count, which avoids copying the
+/// whole toolpath at once for very large toolpaths.
+/// Use OperationBase.generatedDataCollection.itemByIdentifier with ToolpathGeneratedDataType to get this object.
+class ToolpathData : public GeneratedData {
+public:
+
+    /// Returns the total number of points in the toolpath.
+    int pointCount() const;
+
+    /// Returns the total number of segments in the toolpath.
+    int segmentCount() const;
+
+    /// Returns the tool tip positions as an array of doubles where they are the x, y, z components of each point.
+    /// The positions are in centimeters and defined in the world coordinate system of the setup.
+    /// startIndex : The index of the first point to return.
+    /// count : The number of points to return. Use -1 to return all points from startIndex to the end of the toolpath.
+    /// Returns an array of 3 * count values.
+    std::vector<double> positions(int startIndex = 0, int count = -1) const;
+
+    /// Returns the tool axis at each point as an array of doubles where they are the x, y, z components of each unit vector.
+    /// For 3-axis toolpaths every vector is equal to the tool orientation of the setup.
+    /// startIndex : The index of the first point to return.
+    /// count : The number of points to return. Use -1 to return all points from startIndex to the end of the toolpath.
+    /// Returns an array of 3 * count values.
+    std::vector<double> toolAxes(int startIndex = 0, int count = -1) const;
+
+    /// Returns the feedrate used to move to each point in centimeters per second.
+    /// The value is -1 for rapid moves, where the feedrate is defined by the machine.
+    /// startIndex : The index of the first point to return.
+    /// count : The number of points to return. Use -1 to return all points from startIndex to the end of the toolpath.
+    /// Returns an array of count values.
+    std::vector<double> feedrates(int startIndex = 0, int count = -1) const;
+
+    /// Returns the type of the move to each point. The values are obtained from the ToolpathMoveTypes enum
+    /// and returned as integers.
+    /// startIndex : The index of the first point to return.
+    /// count : The number of points to return. Use -1 to return all points from startIndex to the end of the toolpath.
+    /// Returns an array of count values.
+    std::vector<int> moveTypes(int startIndex = 0, int count = -1) const;
+
+    /// Returns the index of the first point of each segment. A segment ends at the point before the start of the next segment.
+    /// startIndex : The index of the first segment to return.
+    /// count : The number of segments to return. Use -1 to return all segments from startIndex to the end of the toolpath.
+    /// Returns an array of count values.
+    std::vector<int> segmentStartIndices(int startIndex = 0, int count = -1) const;
+
+    /// Returns the type of each segment. The values are obtained from the ToolpathSegmentTypes enum
+    /// and returned as integers.
+    /// startIndex : The index of the first segment to return.
+    /// count : The number of segments to return. Use -1 to return all segments from startIndex to the end of the toolpath.
+    /// Returns an array of count values.
+    std::vector<int> segmentTypes(int startIndex = 0, int count = -1) const;
+
+    /// Returns the center point of each segment as an array of doubles where they are the x, y, z components of each point.
+    /// The value is only meaningful for circular and helical segments and is zero for linear segments.
+    /// startIndex : The index of the first segment to return.
+    /// count : The number of segments to return. Use -1 to return all segments from startIndex to the end of the toolpath.
+    /// Returns an array of 3 * count values.
+    std::vector<double> arcCenters(int startIndex = 0, int count = -1) const;
+
+    /// Returns the normal of the arc plane of each segment as an array of doubles where they are the x, y, z components of each vector.
+    /// The arc runs counter-clockwise around the normal. The value is only meaningful for circular and helical segments
+    /// and is zero for linear segments.
+    /// startIndex : The index of the first segment to return.
+    /// count : The number of segments to return. Use -1 to return all segments from startIndex to the end of the toolpath.
+    /// Returns an array of 3 * count values.
+    std::vector<double> arcNormals(int startIndex = 0, int count = -1) const;
+
+    ADSK_CAM_TOOLPATHDATA_API static const char* classType();
+    ADSK_CAM_TOOLPATHDATA_API const char* objectType() const override;
+    ADSK_CAM_TOOLPATHDATA_API void* queryInterface(const char* id) const override;
+    ADSK_CAM_TOOLPATHDATA_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual int pointCount_raw() const = 0;
+    virtual int segmentCount_raw() const = 0;
+    virtual double* positions_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual double* toolAxes_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual double* feedrates_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual int* moveTypes_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual int* segmentStartIndices_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual int* segmentTypes_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual double* arcCenters_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual double* arcNormals_raw(int startIndex, int count, size_t& return_size) const = 0;
+};
+
+// Inline wrappers
+
+inline int ToolpathData::pointCount() const
+{
+    int res = pointCount_raw();
+    return res;
+}
+
+inline int ToolpathData::segmentCount() const
+{
+    int res = segmentCount_raw();
+    return res;
+}
+
+inline std::vector<double> ToolpathData::positions(int startIndex, int count) const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= positions_raw(startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> ToolpathData::toolAxes(int startIndex, int count) const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= toolAxes_raw(startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> ToolpathData::feedrates(int startIndex, int count) const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= feedrates_raw(startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<int> ToolpathData::moveTypes(int startIndex, int count) const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= moveTypes_raw(startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<int> ToolpathData::segmentStartIndices(int startIndex, int count) const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= segmentStartIndices_raw(startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<int> ToolpathData::segmentTypes(int startIndex, int count) const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= segmentTypes_raw(startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> ToolpathData::arcCenters(int startIndex, int count) const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= arcCenters_raw(startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> ToolpathData::arcNormals(int startIndex, int count) const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= arcNormals_raw(startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+}// namespace cam
+}// namespace adsk
+
+#undef ADSK_CAM_TOOLPATHDATA_API
\ No newline at end of file
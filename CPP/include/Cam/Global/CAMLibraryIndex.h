@@ -0,0 +1,459 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "../../Core/Base.h"
+#include "../CamTypeDefs.h"
+#include <string>
+#include <vector>
+
+// THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
+// THIS HEADER FILE WILL BE GENERATED FROM NIDL.
+#include "../../Core/OSMacros.h"
+
+#ifdef CAMXINTERFACE_EXPORTS
+# ifdef __COMPILING_ADSK_CAM_CAMLIBRARYINDEX_CPP__
+# define ADSK_CAM_CAMLIBRARYINDEX_API XI_EXPORT
+# else
+# define ADSK_CAM_CAMLIBRARYINDEX_API
+# endif
+#else
+# define ADSK_CAM_CAMLIBRARYINDEX_API XI_IMPORT
+#endif
+
+namespace adsk { namespace core {
+    class URL;
+}}
+
+namespace adsk { namespace cam {
+
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// An index of the machines, post configurations and print settings of library folders, stored in a file on disk.
+/// The index keeps the keys used by the library queries and the modification time of each file, so that queries can be
+/// answered without reading the library folders again. Set it as the libraryIndex of the CAMLibraryManager to make
+/// MachineQuery, PostConfigurationQuery, PrintSettingQuery and PostLibrary.childPostConfigurations use it.
+/// Use the CAMLibraryManager.openLibraryIndex method to open or create an index.
+class CAMLibraryIndex : public core::Base {
+public:
+
+    /// Returns the full path of the file the index is stored in.
+    std::string filePath() const;
+
+    /// Adds the folders of a library location to the index. Folders added to the location later are picked up by update.
+    /// entryType : The type of the entries of the library.
+    /// location : The location of the library to add.
+    /// Returns true if the location was added successfully.
+    bool addLibraries(CAMLibraryIndexEntryTypes entryType, LibraryLocations location);
+
+    /// Adds a single library folder and its subfolders to the index, for instance the network machine folder.
+    /// entryType : The type of the entries of the folder.
+    /// url : The URL of the folder to add.
+    /// Returns true if the folder was added successfully.
+    bool addFolder(CAMLibraryIndexEntryTypes entryType, const core::Ptr<core::URL>& url);
+
+    /// Returns the URLs of the folders in the index.
+    std::vector<core::Ptr<core::URL>> folderURLs() const;
+
+    /// Gets and sets the maximum number of folders scanned at the same time by update.
+    /// 0 uses the number of processor cores. Defaults to 0.
+    int maxConcurrency() const;
+    bool maxConcurrency(int value);
+
+    /// Scans the folders of the index in parallel and saves the index to its file. Only files that were added, or whose
+    /// modification time or size changed since the last update, are read. Files that no longer exist are removed from the index.
+    /// Returns the number of files that were read, or -1 if the update failed.
+    int update();
+
+    /// Removes the entries of a folder from the index so they are read again by the next update.
+    /// url : The URL of the folder to invalidate.
+    /// Returns true if the folder was part of the index.
+    bool invalidate(const core::Ptr<core::URL>& url);
+
+    /// Returns the time in seconds spent by the last update.
+    double lastUpdateDuration() const;
+
+    /// Returns the number of entries in the index.
+    int entryCount() const;
+
+    /// Returns the type of each entry. The values are obtained from the CAMLibraryIndexEntryTypes enum and returned as integers.
+    /// startIndex : The index of the first entry to return.
+    /// count : The number of entries to return. Use -1 to return all entries from startIndex to the end of the index.
+    /// Returns an array of count values.
+    std::vector<int> entryTypes(int startIndex = 0, int count = -1) const;
+
+    /// Returns the full path of the file of each entry.
+    /// startIndex : The index of the first entry to return.
+    /// count : The number of entries to return. Use -1 to return all entries from startIndex to the end of the index.
+    /// Returns an array of count values.
+    std::vector<std::string> filePaths(int startIndex = 0, int count = -1) const;
+
+    /// Returns the modification time of the file of each entry when it was last read, in seconds since 1970-01-01 UTC.
+    /// startIndex : The index of the first entry to return.
+    /// count : The number of entries to return. Use -1 to return all entries from startIndex to the end of the index.
+    /// Returns an array of count values.
+    std::vector<double> modificationTimes(int startIndex = 0, int count = -1) const;
+
+    /// Returns the description of each entry.
+    /// startIndex : The index of the first entry to return.
+    /// count : The number of entries to return. Use -1 to return all entries from startIndex to the end of the index.
+    /// Returns an array of count values.
+    std::vector<std::string> descriptions(int startIndex = 0, int count = -1) const;
+
+    /// Returns the vendor of each entry, or an empty string if the entry has no vendor.
+    /// startIndex : The index of the first entry to return.
+    /// count : The number of entries to return. Use -1 to return all entries from startIndex to the end of the index.
+    /// Returns an array of count values.
+    std::vector<std::string> vendors(int startIndex = 0, int count = -1) const;
+
+    /// Returns the model of each machine entry, or an empty string for other entries.
+    /// startIndex : The index of the first entry to return.
+    /// count : The number of entries to return. Use -1 to return all entries from startIndex to the end of the index.
+    /// Returns an array of count values.
+    std::vector<std::string> models(int startIndex = 0, int count = -1) const;
+
+    /// Returns the technology of each print setting entry, or an empty string for other entries.
+    /// startIndex : The index of the first entry to return.
+    /// count : The number of entries to return. Use -1 to return all entries from startIndex to the end of the index.
+    /// Returns an array of count values.
+    std::vector<std::string> technologies(int startIndex = 0, int count = -1) const;
+
+    /// Returns the capabilities of each post configuration entry as a combination of PostCapabilities values, or 0 for other entries.
+    /// startIndex : The index of the first entry to return.
+    /// count : The number of entries to return. Use -1 to return all entries from startIndex to the end of the index.
+    /// Returns an array of count values.
+    std::vector<int> capabilities(int startIndex = 0, int count = -1) const;
+
+    /// Returns the material of each print setting entry, or an empty string for other entries.
+    /// startIndex : The index of the first entry to return.
+    /// count : The number of entries to return. Use -1 to return all entries from startIndex to the end of the index.
+    /// Returns an array of count values.
+    std::vector<std::string> materials(int startIndex = 0, int count = -1) const;
+
+    /// Returns the filament diameter in cm of each FFF print setting entry, or 0 for other entries.
+    /// startIndex : The index of the first entry to return.
+    /// count : The number of entries to return. Use -1 to return all entries from startIndex to the end of the index.
+    /// Returns an array of count values.
+    std::vector<double> filamentDiameters(int startIndex = 0, int count = -1) const;
+
+    /// Returns the layer height in cm of each print setting entry, or 0 for other entries.
+    /// startIndex : The index of the first entry to return.
+    /// count : The number of entries to return. Use -1 to return all entries from startIndex to the end of the index.
+    /// Returns an array of count values.
+    std::vector<double> layerHeights(int startIndex = 0, int count = -1) const;
+
+    ADSK_CAM_CAMLIBRARYINDEX_API static const char* classType();
+    ADSK_CAM_CAMLIBRARYINDEX_API const char* objectType() const override;
+    ADSK_CAM_CAMLIBRARYINDEX_API void* queryInterface(const char* id) const override;
+    ADSK_CAM_CAMLIBRARYINDEX_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual char* filePath_raw() const = 0;
+    virtual bool addLibraries_raw(CAMLibraryIndexEntryTypes entryType, LibraryLocations location) = 0;
+    virtual bool addFolder_raw(CAMLibraryIndexEntryTypes entryType, core::URL* url) = 0;
+    virtual core::URL** folderURLs_raw(size_t& return_size) const = 0;
+    virtual int maxConcurrency_raw() const = 0;
+    virtual bool maxConcurrency_raw(int value) = 0;
+    virtual int update_raw() = 0;
+    virtual bool invalidate_raw(core::URL* url) = 0;
+    virtual double lastUpdateDuration_raw() const = 0;
+    virtual int entryCount_raw() const = 0;
+    virtual int* entryTypes_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual char** filePaths_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual double* modificationTimes_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual char** descriptions_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual char** vendors_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual char** models_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual char** technologies_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual int* capabilities_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual char** materials_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual double* filamentDiameters_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual double* layerHeights_raw(int startIndex, int count, size_t& return_size) const = 0;
+};
+
+// Inline wrappers
+
+inline std::string CAMLibraryIndex::filePath() const
+{
+    std::string res;
+
+    char* p= filePath_raw();
+    if (p)
+    {
+        res = p;
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline bool CAMLibraryIndex::addLibraries(CAMLibraryIndexEntryTypes entryType, LibraryLocations location)
+{
+    bool res = addLibraries_raw(entryType, location);
+    return res;
+}
+
+inline bool CAMLibraryIndex::addFolder(CAMLibraryIndexEntryTypes entryType, const core::Ptr<core::URL>& url)
+{
+    bool res = addFolder_raw(entryType, url.get());
+    return res;
+}
+
+inline std::vector<core::Ptr<core::URL>> CAMLibraryIndex::folderURLs() const
+{
+    std::vector<core::Ptr<core::URL>> res;
+    size_t s;
+
+    core::URL** p= folderURLs_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline int CAMLibraryIndex::maxConcurrency() const
+{
+    int res = maxConcurrency_raw();
+    return res;
+}
+
+inline bool CAMLibraryIndex::maxConcurrency(int value)
+{
+    return maxConcurrency_raw(value);
+}
+
+inline int CAMLibraryIndex::update()
+{
+    int res = update_raw();
+    return res;
+}
+
+inline bool CAMLibraryIndex::invalidate(const core::Ptr<core::URL>& url)
+{
+    bool res = invalidate_raw(url.get());
+    return res;
+}
+
+inline double CAMLibraryIndex::lastUpdateDuration() const
+{
+    double res = lastUpdateDuration_raw();
+    return res;
+}
+
+inline int CAMLibraryIndex::entryCount() const
+{
+    int res = entryCount_raw();
+    return res;
+}
+
+inline std::vector<int> CAMLibraryIndex::entryTypes(int startIndex, int count) const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= entryTypes_raw(startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<std::string> CAMLibraryIndex::filePaths(int startIndex, int count) const
+{
+    std::vector<std::string> res;
+    size_t s;
+
+    char** p= filePaths_raw(startIndex, count, s);
+    if(p)
+    {
+        res.resize(s);
+        for(size_t i=0; i<s; ++i)
+        {
+            char* pChar = p[i];
+            if(pChar)
+                res[i] = pChar;
+            core::DeallocateArray(pChar);
+        }
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> CAMLibraryIndex::modificationTimes(int startIndex, int count) const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= modificationTimes_raw(startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<std::string> CAMLibraryIndex::descriptions(int startIndex, int count) const
+{
+    std::vector<std::string> res;
+    size_t s;
+
+    char** p= descriptions_raw(startIndex, count, s);
+    if(p)
+    {
+        res.resize(s);
+        for(size_t i=0; i<s; ++i)
+        {
+            char* pChar = p[i];
+            if(pChar)
+                res[i] = pChar;
+            core::DeallocateArray(pChar);
+        }
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<std::string> CAMLibraryIndex::vendors(int startIndex, int count) const
+{
+    std::vector<std::string> res;
+    size_t s;
+
+    char** p= vendors_raw(startIndex, count, s);
+    if(p)
+    {
+        res.resize(s);
+        for(size_t i=0; i<s; ++i)
+        {
+            char* pChar = p[i];
+            if(pChar)
+                res[i] = pChar;
+            core::DeallocateArray(pChar);
+        }
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<std::string> CAMLibraryIndex::models(int startIndex, int count) const
+{
+    std::vector<std::string> res;
+    size_t s;
+
+    char** p= models_raw(startIndex, count, s);
+    if(p)
+    {
+        res.resize(s);
+        for(size_t i=0; i<s; ++i)
+        {
+            char* pChar = p[i];
+            if(pChar)
+                res[i] = pChar;
+            core::DeallocateArray(pChar);
+        }
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<std::string> CAMLibraryIndex::technologies(int startIndex, int count) const
+{
+    std::vector<std::string> res;
+    size_t s;
+
+    char** p= technologies_raw(startIndex, count, s);
+    if(p)
+    {
+        res.resize(s);
+        for(size_t i=0; i<s; ++i)
+        {
+            char* pChar = p[i];
+            if(pChar)
+                res[i] = pChar;
+            core::DeallocateArray(pChar);
+        }
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<int> CAMLibraryIndex::capabilities(int startIndex, int count) const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= capabilities_raw(startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<std::string> CAMLibraryIndex::materials(int startIndex, int count) const
+{
+    std::vector<std::string> res;
+    size_t s;
+
+    char** p= materials_raw(startIndex, count, s);
+    if(p)
+    {
+        res.resize(s);
+        for(size_t i=0; i<s; ++i)
+        {
+            char* pChar = p[i];
+            if(pChar)
+                res[i] = pChar;
+            core::DeallocateArray(pChar);
+        }
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> CAMLibraryIndex::filamentDiameters(int startIndex, int count) const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= filamentDiameters_raw(startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> CAMLibraryIndex::layerHeights(int startIndex, int count) const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= layerHeights_raw(startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+}// namespace cam
+}// namespace adsk
+
+#undef ADSK_CAM_CAMLIBRARYINDEX_API
\ No newline at end of file
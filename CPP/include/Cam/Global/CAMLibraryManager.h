@@ -28,6 +28,7 @@
 #endif
 
 namespace adsk { namespace cam {
+    class CAMLibraryIndex;
     class CAMTemplateLibrary;
     class MachineLibrary;
     class PostLibrary;
@@ -102,6 +103,29 @@ public:
     /// You can only get a valid StockMaterialLibrary when you have access to Stock Materials private preview feature and enable the feature flag.
     core::Ptr<StockMaterialLibrary> stockMaterialLibrary() const;
 
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Opens the library index stored in the specified file, or creates a new empty index if the file does not exist.
+    /// Call CAMLibraryIndex.update to bring the index up to date with its folders.
+    /// filePath : The full path of the index file. If empty, the default index file in the user's cache folder is used.
+    /// Returns the library index or null if the file could not be opened.
+    core::Ptr<CAMLibraryIndex> openLibraryIndex(const std::string& filePath);
+
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Gets and sets the library index used to answer machine, post configuration and print setting queries.
+    /// Queries on folders of the index are answered from the index in memory and only the matching files are loaded.
+    /// The vendor, model, technology, capabilities, material, filament diameter and layer height of the queries are matched
+    /// against the index. The machine of a PrintSettingQuery is not indexed: the print settings matching the other fields are
+    /// loaded to check their compatibility with the machine.
+    /// Queries on other folders scan the folders as before. Null by default.
+    core::Ptr<CAMLibraryIndex> libraryIndex() const;
+    bool libraryIndex(const core::Ptr<CAMLibraryIndex>& value);
+
     ADSK_CAM_CAMLIBRARYMANAGER_API static const char* classType();
     ADSK_CAM_CAMLIBRARYMANAGER_API const char* objectType() const override;
     ADSK_CAM_CAMLIBRARYMANAGER_API void* queryInterface(const char* id) const override;
@@ -121,6 +145,9 @@ private:
     virtual PrintSettingLibrary* printSettingLibrary_raw() const = 0;
     virtual PostLibrary* postLibrary_raw() const = 0;
     virtual StockMaterialLibrary* stockMaterialLibrary_raw() const = 0;
+    virtual CAMLibraryIndex* openLibraryIndex_raw(const char* filePath) = 0;
+    virtual CAMLibraryIndex* libraryIndex_raw() const = 0;
+    virtual bool libraryIndex_raw(CAMLibraryIndex* value) = 0;
 };
 
 // Inline wrappers
@@ -225,6 +252,23 @@ inline core::Ptr<StockMaterialLibrary> CAMLibraryManager::stockMaterialLibrary()
     core::Ptr<StockMaterialLibrary> res = stockMaterialLibrary_raw();
     return res;
 }
+
+inline core::Ptr<CAMLibraryIndex> CAMLibraryManager::openLibraryIndex(const std::string& filePath)
+{
+    core::Ptr<CAMLibraryIndex> res = openLibraryIndex_raw(filePath.c_str());
+    return res;
+}
+
+inline core::Ptr<CAMLibraryIndex> CAMLibraryManager::libraryIndex() const
+{
+    core::Ptr<CAMLibraryIndex> res = libraryIndex_raw();
+    return res;
+}
+
+inline bool CAMLibraryManager::libraryIndex(const core::Ptr<CAMLibraryIndex>& value)
+{
+    return libraryIndex_raw(value.get());
+}
 }// namespace cam
 }// namespace adsk
 
@@ -75,6 +75,16 @@ public:
     MachineTCPInterpolationMode tcpRapidInterpolationMode() const;
     bool tcpRapidInterpolationMode(MachineTCPInterpolationMode value);
 
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Number of blocks the controller plans ahead to blend the feedrate over consecutive moves.
+    /// 0 means the count is unknown and the default of the controller is used. 1 means no blending: every move ends at a full stop.
+    /// By default the value is 0.
+    size_t lookAheadBlockCount() const;
+    bool lookAheadBlockCount(size_t value);
+
     ADSK_CAM_CONTROLLERCONFIGURATIONMACHINEELEMENT_API static const char* classType();
     ADSK_CAM_CONTROLLERCONFIGURATIONMACHINEELEMENT_API const char* objectType() const override;
     ADSK_CAM_CONTROLLERCONFIGURATIONMACHINEELEMENT_API void* queryInterface(const char* id) const override;
@@ -93,6 +103,8 @@ private:
     virtual bool nonTcpRapidInterpolationMode_raw(MachineNonTCPInterpolationMode value) = 0;
     virtual MachineTCPInterpolationMode tcpRapidInterpolationMode_raw() const = 0;
     virtual bool tcpRapidInterpolationMode_raw(MachineTCPInterpolationMode value) = 0;
+    virtual size_t lookAheadBlockCount_raw() const = 0;
+    virtual bool lookAheadBlockCount_raw(size_t value) = 0;
 };
 
 // Inline wrappers
@@ -159,6 +171,17 @@ inline bool ControllerConfigurationMachineElement::tcpRapidInterpolationMode(Mac
 {
     return tcpRapidInterpolationMode_raw(value);
 }
+
+inline size_t ControllerConfigurationMachineElement::lookAheadBlockCount() const
+{
+    size_t res = lookAheadBlockCount_raw();
+    return res;
+}
+
+inline bool ControllerConfigurationMachineElement::lookAheadBlockCount(size_t value)
+{
+    return lookAheadBlockCount_raw(value);
+}
 }// namespace cam
 }// namespace adsk
 
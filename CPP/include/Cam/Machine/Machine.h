@@ -32,6 +32,7 @@ namespace adsk { namespace cam {
     class MachineElements;
     class MachineInput;
     class MachineKinematics;
+    class MachineKinematicsSolver;
 }}
 namespace adsk { namespace core {
     class URL;
@@ -156,6 +157,15 @@ public:
     /// Clears the simulation model from the machine.
     void clearSimulationModel();
 
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Creates a solver for the inverse kinematics of this machine, which checks moves for axis limit violations,
+    /// singularities and rotary unwinds before post processing.
+    /// Returns the solver or null if the machine has no kinematics.
+    core::Ptr<MachineKinematicsSolver> createKinematicsSolver() const;
+
     ADSK_CAM_MACHINE_API static const char* classType();
     ADSK_CAM_MACHINE_API const char* objectType() const override;
     ADSK_CAM_MACHINE_API void* queryInterface(const char* id) const override;
@@ -184,6 +194,7 @@ private:
     virtual MachineElements* elements_raw() const = 0;
     virtual bool hasSimulationModel_raw() const = 0;
     virtual void clearSimulationModel_raw() = 0;
+    virtual MachineKinematicsSolver* createKinematicsSolver_raw() const = 0;
 };
 
 // Inline wrappers
@@ -330,6 +341,12 @@ inline void Machine::clearSimulationModel()
 {
     clearSimulationModel_raw();
 }
+
+inline core::Ptr<MachineKinematicsSolver> Machine::createKinematicsSolver() const
+{
+    core::Ptr<MachineKinematicsSolver> res = createKinematicsSolver_raw();
+    return res;
+}
 }// namespace cam
 }// namespace adsk
 
@@ -63,6 +63,24 @@ public:
     MachineAxisCoordinates coordinate() const;
     bool coordinate(MachineAxisCoordinates value);
 
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Specifies the maximum acceleration for this axis. 0 means the acceleration is not limited.
+    /// Units are cm/s^2 for linear axes or rad/s^2 for rotary axes.
+    double maxAcceleration() const;
+    bool maxAcceleration(double value);
+
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Specifies the maximum jerk for this axis. 0 means the jerk is not limited.
+    /// Units are cm/s^3 for linear axes or rad/s^3 for rotary axes.
+    double maxJerk() const;
+    bool maxJerk(double value);
+
     ADSK_CAM_MACHINEAXISCONFIGURATION_API static const char* classType();
     ADSK_CAM_MACHINEAXISCONFIGURATION_API const char* objectType() const override;
     ADSK_CAM_MACHINEAXISCONFIGURATION_API void* queryInterface(const char* id) const override;
@@ -82,6 +100,10 @@ private:
     virtual bool maxRapidSpeed_raw(double value) = 0;
     virtual MachineAxisCoordinates coordinate_raw() const = 0;
     virtual bool coordinate_raw(MachineAxisCoordinates value) = 0;
+    virtual double maxAcceleration_raw() const = 0;
+    virtual bool maxAcceleration_raw(double value) = 0;
+    virtual double maxJerk_raw() const = 0;
+    virtual bool maxJerk_raw(double value) = 0;
     virtual void placeholderMachineAxisConfiguration0() {}
     virtual void placeholderMachineAxisConfiguration1() {}
     virtual void placeholderMachineAxisConfiguration2() {}
@@ -99,10 +121,6 @@ private:
     virtual void placeholderMachineAxisConfiguration14() {}
     virtual void placeholderMachineAxisConfiguration15() {}
     virtual void placeholderMachineAxisConfiguration16() {}
-    virtual void placeholderMachineAxisConfiguration17() {}
-    virtual void placeholderMachineAxisConfiguration18() {}
-    virtual void placeholderMachineAxisConfiguration19() {}
-    virtual void placeholderMachineAxisConfiguration20() {}
 };
 
 // Inline wrappers
@@ -174,6 +192,28 @@ inline bool MachineAxisConfiguration::coordinate(MachineAxisCoordinates value)
 {
     return coordinate_raw(value);
 }
+
+inline double MachineAxisConfiguration::maxAcceleration() const
+{
+    double res = maxAcceleration_raw();
+    return res;
+}
+
+inline bool MachineAxisConfiguration::maxAcceleration(double value)
+{
+    return maxAcceleration_raw(value);
+}
+
+inline double MachineAxisConfiguration::maxJerk() const
+{
+    double res = maxJerk_raw();
+    return res;
+}
+
+inline bool MachineAxisConfiguration::maxJerk(double value)
+{
+    return maxJerk_raw(value);
+}
 }// namespace cam
 }// namespace adsk
 
@@ -0,0 +1,225 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "../../Core/Base.h"
+#include "../CamTypeDefs.h"
+#include <vector>
+
+// THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
+// THIS HEADER FILE WILL BE GENERATED FROM NIDL.
+#include "../../Core/OSMacros.h"
+
+#ifdef CAMXINTERFACE_EXPORTS
+# ifdef __COMPILING_ADSK_CAM_MACHINEKINEMATICSSOLUTION_CPP__
+# define ADSK_CAM_MACHINEKINEMATICSSOLUTION_API XI_EXPORT
+# else
+# define ADSK_CAM_MACHINEKINEMATICSSOLUTION_API
+# endif
+#else
+# define ADSK_CAM_MACHINEKINEMATICSSOLUTION_API XI_IMPORT
+#endif
+
+namespace adsk { namespace cam {
+
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// The axis values solved by a MachineKinematicsSolver for a sequence of moves, together with the issues found.
+/// Moves are indexed in the order of the input: move i ends at position i. When solving an operation, this is
+/// the same index as the points of the ToolpathData of the operation.
+class MachineKinematicsSolution : public core::Base {
+public:
+
+    /// Returns the number of moves that were solved.
+    int moveCount() const;
+
+    /// Returns the number of axis values of each move, which is the size of MachineKinematicsSolver.axisNames.
+    int axisCount() const;
+
+    /// Returns true if every move could be solved without exceeding the range of an axis.
+    bool isReachable() const;
+
+    /// Returns the axis values of each move, in the order of MachineKinematicsSolver.axisNames. Linear axes are in centimeters
+    /// and rotary axes in radians. Of the possible solutions of each move, the one closest to the previous move is chosen.
+    /// startIndex : The index of the first move to return.
+    /// count : The number of moves to return. Use -1 to return all moves from startIndex to the end.
+    /// Returns an array of axisCount * count values.
+    std::vector<double> axisValues(int startIndex = 0, int count = -1) const;
+
+    /// Returns the angle in radians between the tool axis of each move and the nearest singularity of the machine.
+    /// startIndex : The index of the first move to return.
+    /// count : The number of moves to return. Use -1 to return all moves from startIndex to the end.
+    /// Returns an array of count values.
+    std::vector<double> singularityDistances(int startIndex = 0, int count = -1) const;
+
+    /// Returns the number of issues found.
+    int issueCount() const;
+
+    /// Returns the index of the move of each issue.
+    /// startIndex : The index of the first issue to return.
+    /// count : The number of issues to return. Use -1 to return all issues from startIndex to the end.
+    /// Returns an array of count values.
+    std::vector<int> issueMoveIndices(int startIndex = 0, int count = -1) const;
+
+    /// Returns the type of each issue. The values are obtained from the MachineKinematicsIssueTypes enum and returned as integers.
+    /// startIndex : The index of the first issue to return.
+    /// count : The number of issues to return. Use -1 to return all issues from startIndex to the end.
+    /// Returns an array of count values.
+    std::vector<int> issueTypes(int startIndex = 0, int count = -1) const;
+
+    /// Returns the index into MachineKinematicsSolver.axisNames of the axis of each issue, or -1 if the issue is not related to a single axis.
+    /// startIndex : The index of the first issue to return.
+    /// count : The number of issues to return. Use -1 to return all issues from startIndex to the end.
+    /// Returns an array of count values.
+    std::vector<int> issueAxisIndices(int startIndex = 0, int count = -1) const;
+
+    /// Returns a value describing the severity of each issue: the distance beyond the range of the axis for axis limit issues,
+    /// the distance to the singularity for singularity issues and the angle the rotary axis turns back for unwind issues.
+    /// Linear values are in centimeters and angles in radians.
+    /// startIndex : The index of the first issue to return.
+    /// count : The number of issues to return. Use -1 to return all issues from startIndex to the end.
+    /// Returns an array of count values.
+    std::vector<double> issueValues(int startIndex = 0, int count = -1) const;
+
+    ADSK_CAM_MACHINEKINEMATICSSOLUTION_API static const char* classType();
+    ADSK_CAM_MACHINEKINEMATICSSOLUTION_API const char* objectType() const override;
+    ADSK_CAM_MACHINEKINEMATICSSOLUTION_API void* queryInterface(const char* id) const override;
+    ADSK_CAM_MACHINEKINEMATICSSOLUTION_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual int moveCount_raw() const = 0;
+    virtual int axisCount_raw() const = 0;
+    virtual bool isReachable_raw() const = 0;
+    virtual double* axisValues_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual double* singularityDistances_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual int issueCount_raw() const = 0;
+    virtual int* issueMoveIndices_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual int* issueTypes_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual int* issueAxisIndices_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual double* issueValues_raw(int startIndex, int count, size_t& return_size) const = 0;
+};
+
+// Inline wrappers
+
+inline int MachineKinematicsSolution::moveCount() const
+{
+    int res = moveCount_raw();
+    return res;
+}
+
+inline int MachineKinematicsSolution::axisCount() const
+{
+    int res = axisCount_raw();
+    return res;
+}
+
+inline bool MachineKinematicsSolution::isReachable() const
+{
+    bool res = isReachable_raw();
+    return res;
+}
+
+inline std::vector<double> MachineKinematicsSolution::axisValues(int startIndex, int count) const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= axisValues_raw(startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> MachineKinematicsSolution::singularityDistances(int startIndex, int count) const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= singularityDistances_raw(startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline int MachineKinematicsSolution::issueCount() const
+{
+    int res = issueCount_raw();
+    return res;
+}
+
+inline std::vector<int> MachineKinematicsSolution::issueMoveIndices(int startIndex, int count) const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= issueMoveIndices_raw(startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<int> MachineKinematicsSolution::issueTypes(int startIndex, int count) const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= issueTypes_raw(startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<int> MachineKinematicsSolution::issueAxisIndices(int startIndex, int count) const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= issueAxisIndices_raw(startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> MachineKinematicsSolution::issueValues(int startIndex, int count) const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= issueValues_raw(startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+}// namespace cam
+}// namespace adsk
+
+#undef ADSK_CAM_MACHINEKINEMATICSSOLUTION_API
\ No newline at end of file
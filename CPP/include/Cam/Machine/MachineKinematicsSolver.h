@@ -0,0 +1,169 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "../../Core/Base.h"
+#include "../CamTypeDefs.h"
+#include <string>
+#include <vector>
+
+// THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
+// THIS HEADER FILE WILL BE GENERATED FROM NIDL.
+#include "../../Core/OSMacros.h"
+
+#ifdef CAMXINTERFACE_EXPORTS
+# ifdef __COMPILING_ADSK_CAM_MACHINEKINEMATICSSOLVER_CPP__
+# define ADSK_CAM_MACHINEKINEMATICSSOLVER_API XI_EXPORT
+# else
+# define ADSK_CAM_MACHINEKINEMATICSSOLVER_API
+# endif
+#else
+# define ADSK_CAM_MACHINEKINEMATICSSOLVER_API XI_IMPORT
+#endif
+
+namespace adsk { namespace cam {
+    class Machine;
+    class MachineKinematicsSolution;
+    class OperationBase;
+}}
+
+namespace adsk { namespace cam {
+
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// Solves the inverse kinematics of a machine: the values of the linear and rotary axes that put the tool tip at a
+/// position with a tool axis. The kinematic chain is built from the parts and axes of the kinematics element of the machine.
+/// Use the Machine.createKinematicsSolver method to create a solver.
+/// Positions and tool axes are defined in the coordinate system of the workpiece on the machine.
+class MachineKinematicsSolver : public core::Base {
+public:
+
+    /// Returns the machine the solver was created for.
+    core::Ptr<Machine> machine() const;
+
+    /// Returns the names of the axes in the order their values are returned by the solver.
+    std::vector<std::string> axisNames() const;
+
+    /// Gets and sets the axis values the first move is solved from, in the order of axisNames.
+    /// Defaults to the home position of each axis.
+    std::vector<double> initialAxisValues() const;
+    bool initialAxisValues(const std::vector<double>& value);
+
+    /// Gets and sets the angle in radians around a singularity within which a singularity issue is reported.
+    /// Defaults to the cone of the singularity settings of the multi-axis element of the machine.
+    double singularityCone() const;
+    bool singularityCone(double value);
+
+    /// Solves a sequence of moves. The moves are solved in order so that the rotary axes move continuously from one move to the next.
+    /// positions : The tool tip positions as an array of doubles where they are the x, y, z components of each point, in centimeters.
+    /// toolAxes : The tool axes as an array of doubles where they are the x, y, z components of each unit vector.
+    /// The array must have the same size as positions.
+    /// Returns the solution or null if the solve failed.
+    core::Ptr<MachineKinematicsSolution> solve(const std::vector<double>& positions, const std::vector<double>& toolAxes) const;
+
+    /// Solves all moves of the toolpath of an operation. The operation has to be generated.
+    /// operation : The operation to solve. The workpiece is placed on the machine as defined by the parent setup of the operation.
+    /// Returns the solution or null if the solve failed.
+    core::Ptr<MachineKinematicsSolution> solveOperation(const core::Ptr<OperationBase>& operation) const;
+
+    ADSK_CAM_MACHINEKINEMATICSSOLVER_API static const char* classType();
+    ADSK_CAM_MACHINEKINEMATICSSOLVER_API const char* objectType() const override;
+    ADSK_CAM_MACHINEKINEMATICSSOLVER_API void* queryInterface(const char* id) const override;
+    ADSK_CAM_MACHINEKINEMATICSSOLVER_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual Machine* machine_raw() const = 0;
+    virtual char** axisNames_raw(size_t& return_size) const = 0;
+    virtual double* initialAxisValues_raw(size_t& return_size) const = 0;
+    virtual bool initialAxisValues_raw(const double* value, size_t value_size) = 0;
+    virtual double singularityCone_raw() const = 0;
+    virtual bool singularityCone_raw(double value) = 0;
+    virtual MachineKinematicsSolution* solve_raw(const double* positions, size_t positions_size, const double* toolAxes, size_t toolAxes_size) const = 0;
+    virtual MachineKinematicsSolution* solveOperation_raw(OperationBase* operation) const = 0;
+};
+
+// Inline wrappers
+
+inline core::Ptr<Machine> MachineKinematicsSolver::machine() const
+{
+    core::Ptr<Machine> res = machine_raw();
+    return res;
+}
+
+inline std::vector<std::string> MachineKinematicsSolver::axisNames() const
+{
+    std::vector<std::string> res;
+    size_t s;
+
+    char** p= axisNames_raw(s);
+    if(p)
+    {
+        res.resize(s);
+        for(size_t i=0; i<s; ++i)
+        {
+            char* pChar = p[i];
+            if(pChar)
+                res[i] = pChar;
+            core::DeallocateArray(pChar);
+        }
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> MachineKinematicsSolver::initialAxisValues() const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= initialAxisValues_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline bool MachineKinematicsSolver::initialAxisValues(const std::vector<double>& value)
+{
+    return initialAxisValues_raw(value.empty() ? nullptr : &value[0], value.size());
+}
+
+inline double MachineKinematicsSolver::singularityCone() const
+{
+    double res = singularityCone_raw();
+    return res;
+}
+
+inline bool MachineKinematicsSolver::singularityCone(double value)
+{
+    return singularityCone_raw(value);
+}
+
+inline core::Ptr<MachineKinematicsSolution> MachineKinematicsSolver::solve(const std::vector<double>& positions, const std::vector<double>& toolAxes) const
+{
+    core::Ptr<MachineKinematicsSolution> res = solve_raw(positions.empty() ? nullptr : &positions[0], positions.size(), toolAxes.empty() ? nullptr : &toolAxes[0], toolAxes.size());
+    return res;
+}
+
+inline core::Ptr<MachineKinematicsSolution> MachineKinematicsSolver::solveOperation(const core::Ptr<OperationBase>& operation) const
+{
+    core::Ptr<MachineKinematicsSolution> res = solveOperation_raw(operation.get());
+    return res;
+}
+}// namespace cam
+}// namespace adsk
+
+#undef ADSK_CAM_MACHINEKINEMATICSSOLVER_API
\ No newline at end of file
@@ -0,0 +1,118 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "../../Core/Base.h"
+#include "../CamTypeDefs.h"
+#include <vector>
+
+// THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
+// THIS HEADER FILE WILL BE GENERATED FROM NIDL.
+#include "../../Core/OSMacros.h"
+
+#ifdef CAMXINTERFACE_EXPORTS
+# ifdef __COMPILING_ADSK_CAM_NCPROGRAMPOSTPROCESSFUTURE_CPP__
+# define ADSK_CAM_NCPROGRAMPOSTPROCESSFUTURE_API XI_EXPORT
+# else
+# define ADSK_CAM_NCPROGRAMPOSTPROCESSFUTURE_API
+# endif
+#else
+# define ADSK_CAM_NCPROGRAMPOSTPROCESSFUTURE_API XI_IMPORT
+#endif
+
+namespace adsk { namespace cam {
+    class NCProgramPostProcessResult;
+}}
+
+namespace adsk { namespace cam {
+
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// Used to check the state and get back the results of post processing several NC programs in parallel.
+/// The NC code is written to the output folder of each NC program in chunks while it is generated,
+/// so output files grow during post processing and are complete once the result of the NC program is available.
+class NCProgramPostProcessFuture : public core::Base {
+public:
+
+    /// Returns the number of NC programs that are post processed.
+    int numberOfNCPrograms() const;
+
+    /// Returns the number of NC programs whose post processing is complete.
+    int numberOfCompleted() const;
+
+    /// Returns true if all NC programs are post processed.
+    bool isPostProcessingCompleted() const;
+
+    /// Returns the number of bytes written to the output files of all NC programs so far.
+    size_t bytesWritten() const;
+
+    /// Returns the results of the NC programs whose post processing is complete, in the order they completed.
+    std::vector<core::Ptr<NCProgramPostProcessResult>> results() const;
+
+    ADSK_CAM_NCPROGRAMPOSTPROCESSFUTURE_API static const char* classType();
+    ADSK_CAM_NCPROGRAMPOSTPROCESSFUTURE_API const char* objectType() const override;
+    ADSK_CAM_NCPROGRAMPOSTPROCESSFUTURE_API void* queryInterface(const char* id) const override;
+    ADSK_CAM_NCPROGRAMPOSTPROCESSFUTURE_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual int numberOfNCPrograms_raw() const = 0;
+    virtual int numberOfCompleted_raw() const = 0;
+    virtual bool isPostProcessingCompleted_raw() const = 0;
+    virtual size_t bytesWritten_raw() const = 0;
+    virtual NCProgramPostProcessResult** results_raw(size_t& return_size) const = 0;
+};
+
+// Inline wrappers
+
+inline int NCProgramPostProcessFuture::numberOfNCPrograms() const
+{
+    int res = numberOfNCPrograms_raw();
+    return res;
+}
+
+inline int NCProgramPostProcessFuture::numberOfCompleted() const
+{
+    int res = numberOfCompleted_raw();
+    return res;
+}
+
+inline bool NCProgramPostProcessFuture::isPostProcessingCompleted() const
+{
+    bool res = isPostProcessingCompleted_raw();
+    return res;
+}
+
+inline size_t NCProgramPostProcessFuture::bytesWritten() const
+{
+    size_t res = bytesWritten_raw();
+    return res;
+}
+
+inline std::vector<core::Ptr<NCProgramPostProcessResult>> NCProgramPostProcessFuture::results() const
+{
+    std::vector<core::Ptr<NCProgramPostProcessResult>> res;
+    size_t s;
+
+    NCProgramPostProcessResult** p= results_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+}// namespace cam
+}// namespace adsk
+
+#undef ADSK_CAM_NCPROGRAMPOSTPROCESSFUTURE_API
\ No newline at end of file
@@ -54,6 +54,27 @@ public:
     FusionHubExecutionBehaviors fusionHubExecutionBehavior() const;
     bool fusionHubExecutionBehavior(FusionHubExecutionBehaviors value);
 
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Gets and sets the maximum number of NC programs that are post processed at the same time by NCPrograms.postProcessInParallel.
+    /// Each NC program is post processed by its own post engine instance.
+    /// 0 uses the number of processor cores. 0 by default. Ignored by NCProgram.postProcess.
+    int maxConcurrency() const;
+    bool maxConcurrency(int value);
+
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Gets and sets whether post processing is restricted to post configurations that are available without a network connection,
+    /// like the posts in the local post folder (CAMLibraryManager.localPostFolder).
+    /// If true, NC programs using a post configuration that would have to be downloaded fail instead.
+    /// False by default.
+    bool isOfflineOnly() const;
+    bool isOfflineOnly(bool value);
+
     ADSK_CAM_NCPROGRAMPOSTPROCESSOPTIONS_API static const char* classType();
     ADSK_CAM_NCPROGRAMPOSTPROCESSOPTIONS_API const char* objectType() const override;
     ADSK_CAM_NCPROGRAMPOSTPROCESSOPTIONS_API void* queryInterface(const char* id) const override;
@@ -69,6 +90,10 @@ private:
     virtual bool postProcessExecutionBehavior_raw(PostProcessExecutionBehaviors value) = 0;
     virtual FusionHubExecutionBehaviors fusionHubExecutionBehavior_raw() const = 0;
     virtual bool fusionHubExecutionBehavior_raw(FusionHubExecutionBehaviors value) = 0;
+    virtual int maxConcurrency_raw() const = 0;
+    virtual bool maxConcurrency_raw(int value) = 0;
+    virtual bool isOfflineOnly_raw() const = 0;
+    virtual bool isOfflineOnly_raw(bool value) = 0;
 };
 
 // Inline wrappers
@@ -111,6 +136,28 @@ inline bool NCProgramPostProcessOptions::fusionHubExecutionBehavior(FusionHubExe
 {
     return fusionHubExecutionBehavior_raw(value);
 }
+
+inline int NCProgramPostProcessOptions::maxConcurrency() const
+{
+    int res = maxConcurrency_raw();
+    return res;
+}
+
+inline bool NCProgramPostProcessOptions::maxConcurrency(int value)
+{
+    return maxConcurrency_raw(value);
+}
+
+inline bool NCProgramPostProcessOptions::isOfflineOnly() const
+{
+    bool res = isOfflineOnly_raw();
+    return res;
+}
+
+inline bool NCProgramPostProcessOptions::isOfflineOnly(bool value)
+{
+    return isOfflineOnly_raw(value);
+}
 }// namespace cam
 }// namespace adsk
 
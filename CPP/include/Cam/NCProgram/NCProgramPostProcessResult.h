@@ -0,0 +1,166 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "../../Core/Base.h"
+#include "../CamTypeDefs.h"
+#include <string>
+#include <vector>
+
+// THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
+// THIS HEADER FILE WILL BE GENERATED FROM NIDL.
+#include "../../Core/OSMacros.h"
+
+#ifdef CAMXINTERFACE_EXPORTS
+# ifdef __COMPILING_ADSK_CAM_NCPROGRAMPOSTPROCESSRESULT_CPP__
+# define ADSK_CAM_NCPROGRAMPOSTPROCESSRESULT_API XI_EXPORT
+# else
+# define ADSK_CAM_NCPROGRAMPOSTPROCESSRESULT_API
+# endif
+#else
+# define ADSK_CAM_NCPROGRAMPOSTPROCESSRESULT_API XI_IMPORT
+#endif
+
+namespace adsk { namespace cam {
+    class NCProgram;
+}}
+
+namespace adsk { namespace cam {
+
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// The result of post processing a single NC program with NCPrograms.postProcessInParallel.
+class NCProgramPostProcessResult : public core::Base {
+public:
+
+    /// Returns the NC program this result is for.
+    core::Ptr<NCProgram> ncProgram() const;
+
+    /// Returns true if the NC program was post processed successfully.
+    bool isSuccess() const;
+
+    /// Returns the error message if post processing failed, or an empty string otherwise.
+    std::string error() const;
+
+    /// Returns the warnings reported by the post processor.
+    std::vector<std::string> warnings() const;
+
+    /// Returns the time in seconds spent post processing the NC program.
+    double duration() const;
+
+    /// Returns the total size in bytes of the files written for the NC program.
+    size_t outputSize() const;
+
+    /// Returns the full paths of the files written for the NC program.
+    std::vector<std::string> outputFiles() const;
+
+    ADSK_CAM_NCPROGRAMPOSTPROCESSRESULT_API static const char* classType();
+    ADSK_CAM_NCPROGRAMPOSTPROCESSRESULT_API const char* objectType() const override;
+    ADSK_CAM_NCPROGRAMPOSTPROCESSRESULT_API void* queryInterface(const char* id) const override;
+    ADSK_CAM_NCPROGRAMPOSTPROCESSRESULT_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual NCProgram* ncProgram_raw() const = 0;
+    virtual bool isSuccess_raw() const = 0;
+    virtual char* error_raw() const = 0;
+    virtual char** warnings_raw(size_t& return_size) const = 0;
+    virtual double duration_raw() const = 0;
+    virtual size_t outputSize_raw() const = 0;
+    virtual char** outputFiles_raw(size_t& return_size) const = 0;
+};
+
+// Inline wrappers
+
+inline core::Ptr<NCProgram> NCProgramPostProcessResult::ncProgram() const
+{
+    core::Ptr<NCProgram> res = ncProgram_raw();
+    return res;
+}
+
+inline bool NCProgramPostProcessResult::isSuccess() const
+{
+    bool res = isSuccess_raw();
+    return res;
+}
+
+inline std::string NCProgramPostProcessResult::error() const
+{
+    std::string res;
+
+    char* p= error_raw();
+    if (p)
+    {
+        res = p;
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<std::string> NCProgramPostProcessResult::warnings() const
+{
+    std::vector<std::string> res;
+    size_t s;
+
+    char** p= warnings_raw(s);
+    if(p)
+    {
+        res.resize(s);
+        for(size_t i=0; i<s; ++i)
+        {
+            char* pChar = p[i];
+            if(pChar)
+                res[i] = pChar;
+            core::DeallocateArray(pChar);
+        }
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline double NCProgramPostProcessResult::duration() const
+{
+    double res = duration_raw();
+    return res;
+}
+
+inline size_t NCProgramPostProcessResult::outputSize() const
+{
+    size_t res = outputSize_raw();
+    return res;
+}
+
+inline std::vector<std::string> NCProgramPostProcessResult::outputFiles() const
+{
+    std::vector<std::string> res;
+    size_t s;
+
+    char** p= outputFiles_raw(s);
+    if(p)
+    {
+        res.resize(s);
+        for(size_t i=0; i<s; ++i)
+        {
+            char* pChar = p[i];
+            if(pChar)
+                res[i] = pChar;
+            core::DeallocateArray(pChar);
+        }
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+}// namespace cam
+}// namespace adsk
+
+#undef ADSK_CAM_NCPROGRAMPOSTPROCESSRESULT_API
\ No newline at end of file
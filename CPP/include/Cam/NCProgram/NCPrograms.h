@@ -12,6 +12,7 @@
 #include "../../Core/Base.h"
 #include "../CamTypeDefs.h"
 #include <string>
+#include <vector>
 
 // THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
 // THIS HEADER FILE WILL BE GENERATED FROM NIDL.
@@ -30,6 +31,8 @@
 namespace adsk { namespace cam {
     class NCProgram;
     class NCProgramInput;
+    class NCProgramPostProcessFuture;
+    class NCProgramPostProcessOptions;
 }}
 
 namespace adsk { namespace cam {
@@ -68,6 +71,18 @@ public:
     /// Returns the created NC program.
     core::Ptr<NCProgram> add(const core::Ptr<NCProgramInput>& input);
 
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Post processes several NC programs at the same time, each in an isolated post engine instance.
+    /// The method returns immediately; use the returned future to follow the progress and get the result of each NC program.
+    /// ncPrograms : The NC programs to post process. Each NC program must have a post configuration.
+    /// options : NCProgramPostProcessOptions to specify the behavior on internal warnings and the maximum concurrency.
+    /// Can be null if the default values should be used.
+    /// Returns an NCProgramPostProcessFuture object to check the state of the post processing.
+    core::Ptr<NCProgramPostProcessFuture> postProcessInParallel(const std::vector<core::Ptr<NCProgram>>& ncPrograms, const core::Ptr<NCProgramPostProcessOptions>& options);
+
     typedef NCProgram iterable_type;
     template <class OutputIterator> void copyTo(OutputIterator result);
 
@@ -85,6 +100,7 @@ private:
     virtual NCProgram* itemByOperationId_raw(int id) const = 0;
     virtual NCProgramInput* createInput_raw() = 0;
     virtual NCProgram* add_raw(NCProgramInput* input) = 0;
+    virtual NCProgramPostProcessFuture* postProcessInParallel_raw(NCProgram** ncPrograms, size_t ncPrograms_size, NCProgramPostProcessOptions* options) = 0;
 };
 
 // Inline wrappers
@@ -133,6 +149,17 @@ template <class OutputIterator> inline void NCPrograms::copyTo(OutputIterator re
         ++result;
     }
 }
+
+inline core::Ptr<NCProgramPostProcessFuture> NCPrograms::postProcessInParallel(const std::vector<core::Ptr<NCProgram>>& ncPrograms, const core::Ptr<NCProgramPostProcessOptions>& options)
+{
+    NCProgram** ncPrograms_ = new NCProgram*[ncPrograms.size()];
+    for(size_t i=0; i<ncPrograms.size(); ++i)
+        ncPrograms_[i] = ncPrograms[i].get();
+
+    core::Ptr<NCProgramPostProcessFuture> res = postProcessInParallel_raw(ncPrograms_, ncPrograms.size(), options.get());
+    delete[] ncPrograms_;
+    return res;
+}
 }// namespace cam
 }// namespace adsk
 
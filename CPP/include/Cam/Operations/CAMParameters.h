@@ -12,6 +12,7 @@
 #include "../../Core/Base.h"
 #include "../CamTypeDefs.h"
 #include <string>
+#include <vector>
 
 // THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
 // THIS HEADER FILE WILL BE GENERATED FROM NIDL.
@@ -29,6 +30,7 @@
 
 namespace adsk { namespace cam {
     class CAMParameter;
+    class CAMParametersSnapshot;
 }}
 
 namespace adsk { namespace cam {
@@ -58,6 +60,26 @@ public:
     /// Returns true if the reset was successful.
     bool resetToSystemDefaults();
 
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Takes a snapshot of all parameters in the collection in a single call, instead of querying each parameter individually.
+    /// Returns the snapshot or null if it could not be taken.
+    core::Ptr<CAMParametersSnapshot> snapshot();
+
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Sets the expressions of several parameters at once. All expressions are applied first and then validated
+    /// together, and the parent is invalidated only once. If any expression is invalid, none of the parameters is changed.
+    /// names : The ids (internal names) of the parameters to set.
+    /// expressions : The new expressions. The array must have the same size as names.
+    /// failedNames : Output array with the ids of the parameters that do not exist, are not editable or whose expression is invalid.
+    /// Returns true if all expressions were set successfully.
+    bool setExpressions(const std::vector<std::string>& names, const std::vector<std::string>& expressions, std::vector<std::string>& failedNames);
+
     typedef CAMParameter iterable_type;
     template <class OutputIterator> void copyTo(OutputIterator result);
 
@@ -73,6 +95,8 @@ private:
     virtual CAMParameter* itemByName_raw(const char* internalName) const = 0;
     virtual size_t count_raw() const = 0;
     virtual bool resetToSystemDefaults_raw() = 0;
+    virtual CAMParametersSnapshot* snapshot_raw() = 0;
+    virtual bool setExpressions_raw(const char** names, size_t names_size, const char** expressions, size_t expressions_size, char**& failedNames, size_t& failedNames_size) = 0;
 };
 
 // Inline wrappers
@@ -109,6 +133,47 @@ template <class OutputIterator> inline void CAMParameters::copyTo(OutputIterator
         ++result;
     }
 }
+
+inline core::Ptr<CAMParametersSnapshot> CAMParameters::snapshot()
+{
+    core::Ptr<CAMParametersSnapshot> res = snapshot_raw();
+    return res;
+}
+
+inline bool CAMParameters::setExpressions(const std::vector<std::string>& names, const std::vector<std::string>& expressions, std::vector<std::string>& failedNames)
+{
+    const char** names_ = names.empty() ? nullptr : (new const char*[names.size()]);
+    for(size_t i = 0; i < names.size(); ++i)
+    {
+        names_[i] = names[i].c_str();
+    }
+
+    const char** expressions_ = expressions.empty() ? nullptr : (new const char*[expressions.size()]);
+    for(size_t i = 0; i < expressions.size(); ++i)
+    {
+        expressions_[i] = expressions[i].c_str();
+    }
+
+    char** failedNames_ = nullptr;
+    size_t failedNames_size;
+
+    bool res = setExpressions_raw(names_, names.size(), expressions_, expressions.size(), failedNames_, failedNames_size);
+    delete[] names_;
+    delete[] expressions_;
+    if(failedNames_)
+    {
+        failedNames.resize(failedNames_size);
+        for(size_t i=0; i<failedNames_size; ++i)
+        {
+            char* pChar = failedNames_[i];
+            if(pChar)
+                failedNames[i] = pChar;
+            core::DeallocateArray(pChar);
+        }
+        core::DeallocateArray(failedNames_);
+    }
+    return res;
+}
 }// namespace cam
 }// namespace adsk
 
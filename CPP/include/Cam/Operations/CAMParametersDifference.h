@@ -0,0 +1,191 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "../../Core/Base.h"
+#include "../CamTypeDefs.h"
+#include <string>
+#include <vector>
+
+// THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
+// THIS HEADER FILE WILL BE GENERATED FROM NIDL.
+#include "../../Core/OSMacros.h"
+
+#ifdef CAMXINTERFACE_EXPORTS
+# ifdef __COMPILING_ADSK_CAM_CAMPARAMETERSDIFFERENCE_CPP__
+# define ADSK_CAM_CAMPARAMETERSDIFFERENCE_API XI_EXPORT
+# else
+# define ADSK_CAM_CAMPARAMETERSDIFFERENCE_API
+# endif
+#else
+# define ADSK_CAM_CAMPARAMETERSDIFFERENCE_API XI_IMPORT
+#endif
+
+namespace adsk { namespace cam {
+
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// The differences between two CAMParametersSnapshot objects, as returned by CAMParametersSnapshot.compare.
+/// Parameters are matched by their id (internal name) and are considered changed if their expressions differ.
+class CAMParametersDifference : public core::Base {
+public:
+
+    /// Returns true if both snapshots have the same parameters with the same expressions.
+    bool isEqual() const;
+
+    /// Returns the ids of the parameters that only exist in the other snapshot.
+    std::vector<std::string> addedNames() const;
+
+    /// Returns the ids of the parameters that only exist in this snapshot.
+    std::vector<std::string> removedNames() const;
+
+    /// Returns the ids of the parameters whose expression differs.
+    std::vector<std::string> changedNames() const;
+
+    /// Returns the expressions of the changed parameters in this snapshot. The array has the same size and order as changedNames.
+    std::vector<std::string> oldExpressions() const;
+
+    /// Returns the expressions of the changed parameters in the other snapshot. The array has the same size and order as changedNames.
+    std::vector<std::string> newExpressions() const;
+
+    ADSK_CAM_CAMPARAMETERSDIFFERENCE_API static const char* classType();
+    ADSK_CAM_CAMPARAMETERSDIFFERENCE_API const char* objectType() const override;
+    ADSK_CAM_CAMPARAMETERSDIFFERENCE_API void* queryInterface(const char* id) const override;
+    ADSK_CAM_CAMPARAMETERSDIFFERENCE_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual bool isEqual_raw() const = 0;
+    virtual char** addedNames_raw(size_t& return_size) const = 0;
+    virtual char** removedNames_raw(size_t& return_size) const = 0;
+    virtual char** changedNames_raw(size_t& return_size) const = 0;
+    virtual char** oldExpressions_raw(size_t& return_size) const = 0;
+    virtual char** newExpressions_raw(size_t& return_size) const = 0;
+};
+
+// Inline wrappers
+
+inline bool CAMParametersDifference::isEqual() const
+{
+    bool res = isEqual_raw();
+    return res;
+}
+
+inline std::vector<std::string> CAMParametersDifference::addedNames() const
+{
+    std::vector<std::string> res;
+    size_t s;
+
+    char** p= addedNames_raw(s);
+    if(p)
+    {
+        res.resize(s);
+        for(size_t i=0; i<s; ++i)
+        {
+            char* pChar = p[i];
+            if(pChar)
+                res[i] = pChar;
+            core::DeallocateArray(pChar);
+        }
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<std::string> CAMParametersDifference::removedNames() const
+{
+    std::vector<std::string> res;
+    size_t s;
+
+    char** p= removedNames_raw(s);
+    if(p)
+    {
+        res.resize(s);
+        for(size_t i=0; i<s; ++i)
+        {
+            char* pChar = p[i];
+            if(pChar)
+                res[i] = pChar;
+            core::DeallocateArray(pChar);
+        }
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<std::string> CAMParametersDifference::changedNames() const
+{
+    std::vector<std::string> res;
+    size_t s;
+
+    char** p= changedNames_raw(s);
+    if(p)
+    {
+        res.resize(s);
+        for(size_t i=0; i<s; ++i)
+        {
+            char* pChar = p[i];
+            if(pChar)
+                res[i] = pChar;
+            core::DeallocateArray(pChar);
+        }
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<std::string> CAMParametersDifference::oldExpressions() const
+{
+    std::vector<std::string> res;
+    size_t s;
+
+    char** p= oldExpressions_raw(s);
+    if(p)
+    {
+        res.resize(s);
+        for(size_t i=0; i<s; ++i)
+        {
+            char* pChar = p[i];
+            if(pChar)
+                res[i] = pChar;
+            core::DeallocateArray(pChar);
+        }
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<std::string> CAMParametersDifference::newExpressions() const
+{
+    std::vector<std::string> res;
+    size_t s;
+
+    char** p= newExpressions_raw(s);
+    if(p)
+    {
+        res.resize(s);
+        for(size_t i=0; i<s; ++i)
+        {
+            char* pChar = p[i];
+            if(pChar)
+                res[i] = pChar;
+            core::DeallocateArray(pChar);
+        }
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+}// namespace cam
+}// namespace adsk
+
+#undef ADSK_CAM_CAMPARAMETERSDIFFERENCE_API
\ No newline at end of file
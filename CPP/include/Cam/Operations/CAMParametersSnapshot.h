@@ -0,0 +1,292 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "../../Core/Base.h"
+#include "../CamTypeDefs.h"
+#include <string>
+#include <vector>
+
+// THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
+// THIS HEADER FILE WILL BE GENERATED FROM NIDL.
+#include "../../Core/OSMacros.h"
+
+#ifdef CAMXINTERFACE_EXPORTS
+# ifdef __COMPILING_ADSK_CAM_CAMPARAMETERSSNAPSHOT_CPP__
+# define ADSK_CAM_CAMPARAMETERSSNAPSHOT_API XI_EXPORT
+# else
+# define ADSK_CAM_CAMPARAMETERSSNAPSHOT_API
+# endif
+#else
+# define ADSK_CAM_CAMPARAMETERSSNAPSHOT_API XI_IMPORT
+#endif
+
+namespace adsk { namespace cam {
+    class CAMParametersDifference;
+    class CAMParametersSnapshot;
+}}
+
+namespace adsk { namespace cam {
+
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// A read-only copy of all parameters of an operation or a tool, taken with a single call of CAMParameters.snapshot.
+/// Instead of one object per parameter, the ids, expressions, values and flags of all parameters are available as
+/// parallel arrays. The snapshot is not updated when the parameters change afterwards.
+class CAMParametersSnapshot : public core::Base {
+public:
+
+    /// Returns the object the parameters belong to, like an operation or a tool.
+    core::Ptr<core::Base> parent() const;
+
+    /// Returns the number of parameters in the snapshot.
+    size_t count() const;
+
+    /// Returns the id (internal name) of each parameter.
+    std::vector<std::string> names() const;
+
+    /// Returns the expression of each parameter. The array has one entry for each parameter, in the same order as names.
+    std::vector<std::string> expressions() const;
+
+    /// Returns the type of the value of each parameter. The values are obtained from the CAMParameterValueTypes enum
+    /// and returned as integers. The array has one entry for each parameter, in the same order as names.
+    std::vector<int> valueTypes() const;
+
+    /// Returns the value of each float, integer and boolean parameter. Float values are in internal units, boolean values
+    /// are 1 for true and 0 for false. The entry is 0 for parameters of other types. The array has one entry for each parameter, in the same order as names.
+    std::vector<double> numericValues() const;
+
+    /// Returns the value of each string parameter and the selected choice of each choice parameter.
+    /// The entry is empty for parameters of other types. The array has one entry for each parameter, in the same order as names.
+    std::vector<std::string> stringValues() const;
+
+    /// Returns whether each parameter is enabled. The array has one entry for each parameter, in the same order as names.
+    std::vector<bool> isEnabled() const;
+
+    /// Returns whether each parameter is editable. The array has one entry for each parameter, in the same order as names.
+    std::vector<bool> isEditable() const;
+
+    /// Returns whether each parameter is visible in the user interface. The array has one entry for each parameter, in the same order as names.
+    std::vector<bool> isVisible() const;
+
+    /// Returns whether each parameter has an error. The array has one entry for each parameter, in the same order as names.
+    std::vector<bool> hasError() const;
+
+    /// Returns the index of a parameter in the arrays of the snapshot.
+    /// internalName : The id (internal name) of the parameter.
+    /// Returns the index of the parameter or -1 if the snapshot has no parameter with the specified id.
+    int indexByName(const std::string& internalName) const;
+
+    /// Compares this snapshot with another snapshot, for instance of the same operation at a later time or of another operation.
+    /// other : The snapshot to compare with.
+    /// Returns the differences between the two snapshots.
+    core::Ptr<CAMParametersDifference> compare(const core::Ptr<CAMParametersSnapshot>& other) const;
+
+    ADSK_CAM_CAMPARAMETERSSNAPSHOT_API static const char* classType();
+    ADSK_CAM_CAMPARAMETERSSNAPSHOT_API const char* objectType() const override;
+    ADSK_CAM_CAMPARAMETERSSNAPSHOT_API void* queryInterface(const char* id) const override;
+    ADSK_CAM_CAMPARAMETERSSNAPSHOT_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual core::Base* parent_raw() const = 0;
+    virtual size_t count_raw() const = 0;
+    virtual char** names_raw(size_t& return_size) const = 0;
+    virtual char** expressions_raw(size_t& return_size) const = 0;
+    virtual int* valueTypes_raw(size_t& return_size) const = 0;
+    virtual double* numericValues_raw(size_t& return_size) const = 0;
+    virtual char** stringValues_raw(size_t& return_size) const = 0;
+    virtual bool* isEnabled_raw(size_t& return_size) const = 0;
+    virtual bool* isEditable_raw(size_t& return_size) const = 0;
+    virtual bool* isVisible_raw(size_t& return_size) const = 0;
+    virtual bool* hasError_raw(size_t& return_size) const = 0;
+    virtual int indexByName_raw(const char* internalName) const = 0;
+    virtual CAMParametersDifference* compare_raw(CAMParametersSnapshot* other) const = 0;
+};
+
+// Inline wrappers
+
+inline core::Ptr<core::Base> CAMParametersSnapshot::parent() const
+{
+    core::Ptr<core::Base> res = parent_raw();
+    return res;
+}
+
+inline size_t CAMParametersSnapshot::count() const
+{
+    size_t res = count_raw();
+    return res;
+}
+
+inline std::vector<std::string> CAMParametersSnapshot::names() const
+{
+    std::vector<std::string> res;
+    size_t s;
+
+    char** p= names_raw(s);
+    if(p)
+    {
+        res.resize(s);
+        for(size_t i=0; i<s; ++i)
+        {
+            char* pChar = p[i];
+            if(pChar)
+                res[i] = pChar;
+            core::DeallocateArray(pChar);
+        }
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<std::string> CAMParametersSnapshot::expressions() const
+{
+    std::vector<std::string> res;
+    size_t s;
+
+    char** p= expressions_raw(s);
+    if(p)
+    {
+        res.resize(s);
+        for(size_t i=0; i<s; ++i)
+        {
+            char* pChar = p[i];
+            if(pChar)
+                res[i] = pChar;
+            core::DeallocateArray(pChar);
+        }
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<int> CAMParametersSnapshot::valueTypes() const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= valueTypes_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> CAMParametersSnapshot::numericValues() const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= numericValues_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<std::string> CAMParametersSnapshot::stringValues() const
+{
+    std::vector<std::string> res;
+    size_t s;
+
+    char** p= stringValues_raw(s);
+    if(p)
+    {
+        res.resize(s);
+        for(size_t i=0; i<s; ++i)
+        {
+            char* pChar = p[i];
+            if(pChar)
+                res[i] = pChar;
+            core::DeallocateArray(pChar);
+        }
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<bool> CAMParametersSnapshot::isEnabled() const
+{
+    std::vector<bool> res;
+    size_t s;
+
+    bool* p= isEnabled_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<bool> CAMParametersSnapshot::isEditable() const
+{
+    std::vector<bool> res;
+    size_t s;
+
+    bool* p= isEditable_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<bool> CAMParametersSnapshot::isVisible() const
+{
+    std::vector<bool> res;
+    size_t s;
+
+    bool* p= isVisible_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<bool> CAMParametersSnapshot::hasError() const
+{
+    std::vector<bool> res;
+    size_t s;
+
+    bool* p= hasError_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline int CAMParametersSnapshot::indexByName(const std::string& internalName) const
+{
+    int res = indexByName_raw(internalName.c_str());
+    return res;
+}
+
+inline core::Ptr<CAMParametersDifference> CAMParametersSnapshot::compare(const core::Ptr<CAMParametersSnapshot>& other) const
+{
+    core::Ptr<CAMParametersDifference> res = compare_raw(other.get());
+    return res;
+}
+}// namespace cam
+}// namespace adsk
+
+#undef ADSK_CAM_CAMPARAMETERSSNAPSHOT_API
\ No newline at end of file
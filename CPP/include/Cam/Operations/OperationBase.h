@@ -12,6 +12,7 @@
 #include "../../Core/Base.h"
 #include "../CamTypeDefs.h"
 #include <string>
+#include <vector>
 
 // THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
 // THIS HEADER FILE WILL BE GENERATED FROM NIDL.
@@ -193,6 +194,16 @@ public:
     /// Returns if remove was successful.
     bool removeReferences(const core::Ptr<core::Base>& entity, bool removeFromChildren);
 
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Returns the faces and bodies the toolpath of this operation depends on. This includes the geometry referenced
+    /// by the geometry selections of the operation, the model bodies of the parent setup and the bodies the stock
+    /// of the parent setup is derived from. The entity tokens of the faces and the revision ids of the bodies
+    /// are recorded when the operation is generated and used to detect which operations are affected by a change.
+    std::vector<core::Ptr<core::Base>> referencedEntities() const;
+
     ADSK_CAM_OPERATIONBASE_API static const char* classType();
     ADSK_CAM_OPERATIONBASE_API const char* objectType() const override;
     ADSK_CAM_OPERATIONBASE_API void* queryInterface(const char* id) const override;
@@ -236,6 +247,7 @@ private:
     virtual bool hasMissingReferences_raw() = 0;
     virtual bool duplicate_raw() = 0;
     virtual bool removeReferences_raw(core::Base* entity, bool removeFromChildren) = 0;
+    virtual core::Base** referencedEntities_raw(size_t& return_size) const = 0;
     virtual void placeholderOperationBase0() {}
     virtual void placeholderOperationBase1() {}
     virtual void placeholderOperationBase2() {}
@@ -264,7 +276,6 @@ private:
     virtual void placeholderOperationBase25() {}
     virtual void placeholderOperationBase26() {}
     virtual void placeholderOperationBase27() {}
-    virtual void placeholderOperationBase28() {}
 };
 
 // Inline wrappers
@@ -507,6 +518,20 @@ inline bool OperationBase::removeReferences(const core::Ptr<core::Base>& entity,
     bool res = removeReferences_raw(entity.get(), removeFromChildren);
     return res;
 }
+
+inline std::vector<core::Ptr<core::Base>> OperationBase::referencedEntities() const
+{
+    std::vector<core::Ptr<core::Base>> res;
+    size_t s;
+
+    core::Base** p= referencedEntities_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
 }// namespace cam
 }// namespace adsk
 
@@ -0,0 +1,310 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "../../Core/Base.h"
+#include "../CamTypeDefs.h"
+#include <string>
+#include <vector>
+
+// THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
+// THIS HEADER FILE WILL BE GENERATED FROM NIDL.
+#include "../../Core/OSMacros.h"
+
+#ifdef CAMXINTERFACE_EXPORTS
+# ifdef __COMPILING_ADSK_CAM_TOOLINDEX_CPP__
+# define ADSK_CAM_TOOLINDEX_API XI_EXPORT
+# else
+# define ADSK_CAM_TOOLINDEX_API
+# endif
+#else
+# define ADSK_CAM_TOOLINDEX_API XI_IMPORT
+#endif
+
+namespace adsk { namespace cam {
+    class ToolQueryResult;
+}}
+namespace adsk { namespace core {
+    class URL;
+}}
+
+namespace adsk { namespace cam {
+
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// An index of the tools of several tool libraries that answers range and nearest-match queries on the key geometry of
+/// the tools without loading the libraries. Each tool is an entry of the index, and the fields of all entries are
+/// stored as columns that can be read as arrays. The index is stored in a file and only the libraries whose content
+/// has changed since the last update are read again.
+/// Use the ToolLibraries.openToolIndex method to get an index.
+class ToolIndex : public core::Base {
+public:
+
+    /// Returns the full path of the file the index is stored in.
+    std::string filePath() const;
+
+    /// Adds all tool libraries of a location to the index. Libraries added to the location later are picked up by update.
+    /// location : The location of the libraries to add.
+    /// Returns true if the location was added successfully.
+    bool addLibraries(LibraryLocations location);
+
+    /// Adds a single tool library to the index.
+    /// url : The URL of the tool library to add.
+    /// Returns true if the library was added successfully.
+    bool addLibrary(const core::Ptr<core::URL>& url);
+
+    /// Reads the libraries that were added since the last update or whose content has changed, and saves the index to its file.
+    /// Libraries that are unchanged are not read again. Libraries that no longer exist are removed from the index.
+    /// Returns the number of libraries that were read, or -1 if the update failed.
+    int update();
+
+    /// Removes the entries of a tool library from the index so they are read again by the next update.
+    /// url : The URL of the tool library to invalidate.
+    /// Returns true if the library was part of the index.
+    bool invalidate(const core::Ptr<core::URL>& url);
+
+    /// Returns the URLs of the tool libraries in the index.
+    std::vector<core::Ptr<core::URL>> libraryURLs() const;
+
+    /// Returns the number of tools in the index.
+    int entryCount() const;
+
+    /// Returns the values of a field for the entries of the index. Lengths are in centimeters.
+    /// The value is 0 if the tool does not have the field.
+    /// field : The field to return.
+    /// startIndex : The index of the first entry to return.
+    /// count : The number of entries to return. Use -1 to return all entries from startIndex to the end of the index.
+    /// Returns an array of count values.
+    std::vector<double> fieldValues(ToolIndexFields field, int startIndex = 0, int count = -1) const;
+
+    /// Returns the description of the holder of each entry, or an empty string if the tool has no holder.
+    /// startIndex : The index of the first entry to return.
+    /// count : The number of entries to return. Use -1 to return all entries from startIndex to the end of the index.
+    /// Returns an array of count values.
+    std::vector<std::string> holderDescriptions(int startIndex = 0, int count = -1) const;
+
+    /// Returns the index into the libraryURLs array of the library of each entry.
+    /// startIndex : The index of the first entry to return.
+    /// count : The number of entries to return. Use -1 to return all entries from startIndex to the end of the index.
+    /// Returns an array of count values.
+    std::vector<int> libraryIndices(int startIndex = 0, int count = -1) const;
+
+    /// Returns the index of the tool of each entry inside its ToolLibrary.
+    /// startIndex : The index of the first entry to return.
+    /// count : The number of entries to return. Use -1 to return all entries from startIndex to the end of the index.
+    /// Returns an array of count values.
+    std::vector<int> toolItemIndices(int startIndex = 0, int count = -1) const;
+
+    /// Finds the entries whose fields are all inside the specified ranges.
+    /// fields : The fields to filter by. The values are obtained from the ToolIndexFields enum.
+    /// minimumValues : The minimum value of each field. The array must have the same size as fields.
+    /// maximumValues : The maximum value of each field. The array must have the same size as fields.
+    /// Returns the indices of the matching entries in ascending order.
+    std::vector<int> findInRange(const std::vector<int>& fields, const std::vector<double>& minimumValues, const std::vector<double>& maximumValues) const;
+
+    /// Finds the entries closest to the specified values. The distance is the sum of the absolute differences of the fields,
+    /// each multiplied by its weight.
+    /// fields : The fields to filter by. The values are obtained from the ToolIndexFields enum.
+    /// values : The target value of each field. The array must have the same size as fields.
+    /// weights : The weight of each field. The array must be empty, which weights all fields with 1, or have the same size as fields.
+    /// maxResults : The maximum number of entries to return.
+    /// Returns the indices of the closest entries, the closest one first.
+    std::vector<int> findNearest(const std::vector<int>& fields, const std::vector<double>& values, const std::vector<double>& weights, int maxResults = 1) const;
+
+    /// Returns the tool of an entry. The tool library of the entry is only loaded when this method is called.
+    /// entryIndex : The index of the entry.
+    /// Returns the result holding the tool and its library, or null if the index is invalid.
+    core::Ptr<ToolQueryResult> entry(int entryIndex) const;
+
+    ADSK_CAM_TOOLINDEX_API static const char* classType();
+    ADSK_CAM_TOOLINDEX_API const char* objectType() const override;
+    ADSK_CAM_TOOLINDEX_API void* queryInterface(const char* id) const override;
+    ADSK_CAM_TOOLINDEX_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual char* filePath_raw() const = 0;
+    virtual bool addLibraries_raw(LibraryLocations location) = 0;
+    virtual bool addLibrary_raw(core::URL* url) = 0;
+    virtual int update_raw() = 0;
+    virtual bool invalidate_raw(core::URL* url) = 0;
+    virtual core::URL** libraryURLs_raw(size_t& return_size) const = 0;
+    virtual int entryCount_raw() const = 0;
+    virtual double* fieldValues_raw(ToolIndexFields field, int startIndex, int count, size_t& return_size) const = 0;
+    virtual char** holderDescriptions_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual int* libraryIndices_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual int* toolItemIndices_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual int* findInRange_raw(const int* fields, size_t fields_size, const double* minimumValues, size_t minimumValues_size, const double* maximumValues, size_t maximumValues_size, size_t& return_size) const = 0;
+    virtual int* findNearest_raw(const int* fields, size_t fields_size, const double* values, size_t values_size, const double* weights, size_t weights_size, int maxResults, size_t& return_size) const = 0;
+    virtual ToolQueryResult* entry_raw(int entryIndex) const = 0;
+};
+
+// Inline wrappers
+
+inline std::string ToolIndex::filePath() const
+{
+    std::string res;
+
+    char* p= filePath_raw();
+    if (p)
+    {
+        res = p;
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline bool ToolIndex::addLibraries(LibraryLocations location)
+{
+    bool res = addLibraries_raw(location);
+    return res;
+}
+
+inline bool ToolIndex::addLibrary(const core::Ptr<core::URL>& url)
+{
+    bool res = addLibrary_raw(url.get());
+    return res;
+}
+
+inline int ToolIndex::update()
+{
+    int res = update_raw();
+    return res;
+}
+
+inline bool ToolIndex::invalidate(const core::Ptr<core::URL>& url)
+{
+    bool res = invalidate_raw(url.get());
+    return res;
+}
+
+inline std::vector<core::Ptr<core::URL>> ToolIndex::libraryURLs() const
+{
+    std::vector<core::Ptr<core::URL>> res;
+    size_t s;
+
+    core::URL** p= libraryURLs_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline int ToolIndex::entryCount() const
+{
+    int res = entryCount_raw();
+    return res;
+}
+
+inline std::vector<double> ToolIndex::fieldValues(ToolIndexFields field, int startIndex, int count) const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= fieldValues_raw(field, startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<std::string> ToolIndex::holderDescriptions(int startIndex, int count) const
+{
+    std::vector<std::string> res;
+    size_t s;
+
+    char** p= holderDescriptions_raw(startIndex, count, s);
+    if(p)
+    {
+        res.resize(s);
+        for(size_t i=0; i<s; ++i)
+        {
+            char* pChar = p[i];
+            if(pChar)
+                res[i] = pChar;
+            core::DeallocateArray(pChar);
+        }
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<int> ToolIndex::libraryIndices(int startIndex, int count) const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= libraryIndices_raw(startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<int> ToolIndex::toolItemIndices(int startIndex, int count) const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= toolItemIndices_raw(startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<int> ToolIndex::findInRange(const std::vector<int>& fields, const std::vector<double>& minimumValues, const std::vector<double>& maximumValues) const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= findInRange_raw(fields.empty() ? nullptr : &fields[0], fields.size(), minimumValues.empty() ? nullptr : &minimumValues[0], minimumValues.size(), maximumValues.empty() ? nullptr : &maximumValues[0], maximumValues.size(), s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<int> ToolIndex::findNearest(const std::vector<int>& fields, const std::vector<double>& values, const std::vector<double>& weights, int maxResults) const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= findNearest_raw(fields.empty() ? nullptr : &fields[0], fields.size(), values.empty() ? nullptr : &values[0], values.size(), weights.empty() ? nullptr : &weights[0], weights.size(), maxResults, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline core::Ptr<ToolQueryResult> ToolIndex::entry(int entryIndex) const
+{
+    core::Ptr<ToolQueryResult> res = entry_raw(entryIndex);
+    return res;
+}
+}// namespace cam
+}// namespace adsk
+
+#undef ADSK_CAM_TOOLINDEX_API
\ No newline at end of file
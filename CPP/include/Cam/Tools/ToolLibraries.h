@@ -28,6 +28,7 @@
 #endif
 
 namespace adsk { namespace cam {
+    class ToolIndex;
     class ToolLibrary;
     class ToolQuery;
 }}
@@ -68,6 +69,16 @@ public:
     /// Returns a new ToolQuery. The query is predefined by given parameter.
     core::Ptr<ToolQuery> createQuery(LibraryLocations location) const;
 
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Opens the tool index stored in the specified file, or creates a new empty index if the file does not exist.
+    /// Call ToolIndex.update to bring the index up to date with its libraries.
+    /// filePath : The full path of the index file. If empty, the default index file in the user's cache folder is used.
+    /// Returns the tool index or null if the file could not be opened.
+    core::Ptr<ToolIndex> openToolIndex(const std::string& filePath);
+
     ADSK_CAM_TOOLLIBRARIES_API static const char* classType();
     ADSK_CAM_TOOLLIBRARIES_API const char* objectType() const override;
     ADSK_CAM_TOOLLIBRARIES_API void* queryInterface(const char* id) const override;
@@ -80,6 +91,7 @@ private:
     virtual bool updateToolLibrary_raw(core::URL* url, ToolLibrary* toolLibrary) = 0;
     virtual ToolLibrary* toolLibraryAtURL_raw(core::URL* url) = 0;
     virtual ToolQuery* createQuery_raw(LibraryLocations location) const = 0;
+    virtual ToolIndex* openToolIndex_raw(const char* filePath) = 0;
 };
 
 // Inline wrappers
@@ -107,6 +119,12 @@ inline core::Ptr<ToolQuery> ToolLibraries::createQuery(LibraryLocations location
     core::Ptr<ToolQuery> res = createQuery_raw(location);
     return res;
 }
+
+inline core::Ptr<ToolIndex> ToolLibraries::openToolIndex(const std::string& filePath)
+{
+    core::Ptr<ToolIndex> res = openToolIndex_raw(filePath.c_str());
+    return res;
+}
 }// namespace cam
 }// namespace adsk
 
@@ -0,0 +1,148 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "../../Core/Base.h"
+#include "../FusionTypeDefs.h"
+#include <vector>
+
+// THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
+// THIS HEADER FILE WILL BE GENERATED FROM NIDL.
+#include "../../Core/OSMacros.h"
+
+#ifdef FUSIONXINTERFACE_EXPORTS
+# ifdef __COMPILING_ADSK_FUSION_ARRANGE3DPACKINGRESULT_CPP__
+# define ADSK_FUSION_ARRANGE3DPACKINGRESULT_API XI_EXPORT
+# else
+# define ADSK_FUSION_ARRANGE3DPACKINGRESULT_API
+# endif
+#else
+# define ADSK_FUSION_ARRANGE3DPACKINGRESULT_API XI_IMPORT
+#endif
+
+namespace adsk { namespace core {
+    class Matrix3D;
+}}
+namespace adsk { namespace fusion {
+    class Occurrence;
+}}
+
+namespace adsk { namespace fusion {
+
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// The result of computing a 3D arrangement with ArrangeFeatures.compute3DArrangement.
+/// The arrangement is not applied to the model. Apply the transforms to the occurrences, or pass the same input
+/// to ArrangeFeatures.add to create the arrange feature.
+class Arrange3DPackingResult : public core::Base {
+public:
+
+    /// Returns the occurrence of each placed part. An occurrence is returned several times if its quantity is more than one.
+    std::vector<core::Ptr<Occurrence>> occurrences() const;
+
+    /// Returns the transform of each placed part, relative to the current position of its occurrence.
+    /// The array has the same size and order as occurrences.
+    std::vector<core::Ptr<core::Matrix3D>> transforms() const;
+
+    /// Returns the occurrences of the parts that did not fit into the envelope, once for each part that was not placed.
+    std::vector<core::Ptr<Occurrence>> unplacedOccurrences() const;
+
+    /// Returns the volume of the placed parts divided by the volume of the envelope up to the top of the highest part, from 0 to 1.
+    double packingDensity() const;
+
+    /// Returns the height in centimeters from the bottom of the envelope to the top of the highest part.
+    double usedHeight() const;
+
+    /// Returns the time in seconds spent computing the arrangement.
+    double duration() const;
+
+    ADSK_FUSION_ARRANGE3DPACKINGRESULT_API static const char* classType();
+    ADSK_FUSION_ARRANGE3DPACKINGRESULT_API const char* objectType() const override;
+    ADSK_FUSION_ARRANGE3DPACKINGRESULT_API void* queryInterface(const char* id) const override;
+    ADSK_FUSION_ARRANGE3DPACKINGRESULT_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual Occurrence** occurrences_raw(size_t& return_size) const = 0;
+    virtual core::Matrix3D** transforms_raw(size_t& return_size) const = 0;
+    virtual Occurrence** unplacedOccurrences_raw(size_t& return_size) const = 0;
+    virtual double packingDensity_raw() const = 0;
+    virtual double usedHeight_raw() const = 0;
+    virtual double duration_raw() const = 0;
+};
+
+// Inline wrappers
+
+inline std::vector<core::Ptr<Occurrence>> Arrange3DPackingResult::occurrences() const
+{
+    std::vector<core::Ptr<Occurrence>> res;
+    size_t s;
+
+    Occurrence** p= occurrences_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<core::Ptr<core::Matrix3D>> Arrange3DPackingResult::transforms() const
+{
+    std::vector<core::Ptr<core::Matrix3D>> res;
+    size_t s;
+
+    core::Matrix3D** p= transforms_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<core::Ptr<Occurrence>> Arrange3DPackingResult::unplacedOccurrences() const
+{
+    std::vector<core::Ptr<Occurrence>> res;
+    size_t s;
+
+    Occurrence** p= unplacedOccurrences_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline double Arrange3DPackingResult::packingDensity() const
+{
+    double res = packingDensity_raw();
+    return res;
+}
+
+inline double Arrange3DPackingResult::usedHeight() const
+{
+    double res = usedHeight_raw();
+    return res;
+}
+
+inline double Arrange3DPackingResult::duration() const
+{
+    double res = duration_raw();
+    return res;
+}
+}// namespace fusion
+}// namespace adsk
+
+#undef ADSK_FUSION_ARRANGE3DPACKINGRESULT_API
\ No newline at end of file
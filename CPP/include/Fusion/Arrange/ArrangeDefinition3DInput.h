@@ -10,6 +10,7 @@
 
 #pragma once
 #include "ArrangeDefinitionInput.h"
+#include "../FusionTypeDefs.h"
 
 // THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
 // THIS HEADER FILE WILL BE GENERATED FROM NIDL.
@@ -25,12 +26,62 @@
 # define ADSK_FUSION_ARRANGEDEFINITION3DINPUT_API XI_IMPORT
 #endif
 
+namespace adsk { namespace core {
+    class ValueInput;
+}}
+
 namespace adsk { namespace fusion {
 
 /// This object defines all of the settings associated with a 3D arrangement.
 class ArrangeDefinition3DInput : public ArrangeDefinitionInput {
 public:
 
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Gets and sets how the shape of the parts is approximated. BoundingBoxArrange3DShapeType by default.
+    /// With VoxelArrange3DShapeType, the parts are tessellated and converted to voxels of size voxelSize, and the
+    /// objectSpacing of the envelope is kept between the voxels of different parts.
+    Arrange3DShapeTypes shapeType() const;
+    bool shapeType(Arrange3DShapeTypes value);
+
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Gets and sets the edge length of the voxels used when shapeType is VoxelArrange3DShapeType.
+    /// Smaller voxels follow the shape of the parts more closely at the cost of memory and time.
+    /// If the ValueInput is created using a real number it is in centimeters. Defaults to 0.2 cm.
+    core::Ptr<core::ValueInput> voxelSize() const;
+    bool voxelSize(const core::Ptr<core::ValueInput>& value);
+
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Gets and sets the rotations allowed for all parts. NoneArrange3DRotationType by default.
+    Arrange3DRotationTypes globalRotation() const;
+    bool globalRotation(Arrange3DRotationTypes value);
+
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Gets and sets the time in seconds spent improving the arrangement after all parts have been placed.
+    /// 0 disables the improvement. 0 by default.
+    double searchTimeLimit() const;
+    bool searchTimeLimit(double value);
+
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Gets and sets the maximum number of threads used to compute the arrangement.
+    /// 0 uses the number of processor cores. 0 by default.
+    int maxConcurrency() const;
+    bool maxConcurrency(int value);
+
     ADSK_FUSION_ARRANGEDEFINITION3DINPUT_API static const char* classType();
     ADSK_FUSION_ARRANGEDEFINITION3DINPUT_API const char* objectType() const override;
     ADSK_FUSION_ARRANGEDEFINITION3DINPUT_API void* queryInterface(const char* id) const override;
@@ -39,12 +90,74 @@ public:
 private:
 
     // Raw interface
-
+    virtual Arrange3DShapeTypes shapeType_raw() const = 0;
+    virtual bool shapeType_raw(Arrange3DShapeTypes value) = 0;
+    virtual core::ValueInput* voxelSize_raw() const = 0;
+    virtual bool voxelSize_raw(core::ValueInput* value) = 0;
+    virtual Arrange3DRotationTypes globalRotation_raw() const = 0;
+    virtual bool globalRotation_raw(Arrange3DRotationTypes value) = 0;
+    virtual double searchTimeLimit_raw() const = 0;
+    virtual bool searchTimeLimit_raw(double value) = 0;
+    virtual int maxConcurrency_raw() const = 0;
+    virtual bool maxConcurrency_raw(int value) = 0;
 };
 
 // Inline wrappers
 
+inline Arrange3DShapeTypes ArrangeDefinition3DInput::shapeType() const
+{
+    Arrange3DShapeTypes res = shapeType_raw();
+    return res;
+}
+
+inline bool ArrangeDefinition3DInput::shapeType(Arrange3DShapeTypes value)
+{
+    return shapeType_raw(value);
+}
+
+inline core::Ptr<core::ValueInput> ArrangeDefinition3DInput::voxelSize() const
+{
+    core::Ptr<core::ValueInput> res = voxelSize_raw();
+    return res;
+}
+
+inline bool ArrangeDefinition3DInput::voxelSize(const core::Ptr<core::ValueInput>& value)
+{
+    return voxelSize_raw(value.get());
+}
+
+inline Arrange3DRotationTypes ArrangeDefinition3DInput::globalRotation() const
+{
+    Arrange3DRotationTypes res = globalRotation_raw();
+    return res;
+}
+
+inline bool ArrangeDefinition3DInput::globalRotation(Arrange3DRotationTypes value)
+{
+    return globalRotation_raw(value);
+}
+
+inline double ArrangeDefinition3DInput::searchTimeLimit() const
+{
+    double res = searchTimeLimit_raw();
+    return res;
+}
+
+inline bool ArrangeDefinition3DInput::searchTimeLimit(double value)
+{
+    return searchTimeLimit_raw(value);
+}
+
+inline int ArrangeDefinition3DInput::maxConcurrency() const
+{
+    int res = maxConcurrency_raw();
+    return res;
+}
 
+inline bool ArrangeDefinition3DInput::maxConcurrency(int value)
+{
+    return maxConcurrency_raw(value);
+}
 }// namespace fusion
 }// namespace adsk
 
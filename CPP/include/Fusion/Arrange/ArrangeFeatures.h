@@ -28,6 +28,7 @@
 #endif
 
 namespace adsk { namespace fusion {
+    class Arrange3DPackingResult;
     class ArrangeFeature;
     class ArrangeFeatureInput;
 }}
@@ -69,6 +70,17 @@ public:
     /// Returns the newly created ArrangeFeature object.
     core::Ptr<ArrangeFeature> add(const core::Ptr<ArrangeFeatureInput>& input);
 
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Computes a 3D arrangement without creating an arrange feature or moving any occurrence, for instance to compare
+    /// the packing density of different settings. Parts are placed in parallel and the placement is then improved for the
+    /// searchTimeLimit of the definition.
+    /// input : An ArrangeFeatureInput created with Arrange3DSolverType that defines the parts, the envelope and the settings.
+    /// Returns the computed arrangement or null if it could not be computed.
+    core::Ptr<Arrange3DPackingResult> compute3DArrangement(const core::Ptr<ArrangeFeatureInput>& input);
+
     typedef ArrangeFeature iterable_type;
     template <class OutputIterator> void copyTo(OutputIterator result);
 
@@ -85,6 +97,7 @@ private:
     virtual size_t count_raw() const = 0;
     virtual ArrangeFeatureInput* createInput_raw(ArrangeSolverTypes solverType) = 0;
     virtual ArrangeFeature* add_raw(ArrangeFeatureInput* input) = 0;
+    virtual Arrange3DPackingResult* compute3DArrangement_raw(ArrangeFeatureInput* input) = 0;
 };
 
 // Inline wrappers
@@ -127,6 +140,12 @@ template <class OutputIterator> inline void ArrangeFeatures::copyTo(OutputIterat
         ++result;
     }
 }
+
+inline core::Ptr<Arrange3DPackingResult> ArrangeFeatures::compute3DArrangement(const core::Ptr<ArrangeFeatureInput>& input)
+{
+    core::Ptr<Arrange3DPackingResult> res = compute3DArrangement_raw(input.get());
+    return res;
+}
 }// namespace fusion
 }// namespace adsk
 
@@ -0,0 +1,177 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "../../Core/Application/Future.h"
+#include <string>
+#include <vector>
+
+// THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
+// THIS HEADER FILE WILL BE GENERATED FROM NIDL.
+#include "../../Core/OSMacros.h"
+
+#ifdef FUSIONXINTERFACE_EXPORTS
+# ifdef __COMPILING_ADSK_FUSION_CONFIGURATIONBATCHFUTURE_CPP__
+# define ADSK_FUSION_CONFIGURATIONBATCHFUTURE_API XI_EXPORT
+# else
+# define ADSK_FUSION_CONFIGURATIONBATCHFUTURE_API
+# endif
+#else
+# define ADSK_FUSION_CONFIGURATIONBATCHFUTURE_API XI_IMPORT
+#endif
+
+namespace adsk { namespace fusion {
+    class ConfigurationRow;
+}}
+
+namespace adsk { namespace fusion {
+
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// Used to check the state and get back the results of generating several rows of a configuration table with
+/// ConfigurationRows.generateRows. The state of the future is finished once all rows are generated or skipped,
+/// and failed if at least one row could not be generated.
+class ConfigurationBatchFuture : public core::Future {
+public:
+
+    /// Returns the rows that are generated.
+    std::vector<core::Ptr<ConfigurationRow>> rows() const;
+
+    /// Returns the number of rows whose generation is complete, including the skipped and failed rows.
+    int numberOfCompleted() const;
+
+    /// Returns the number of rows that were not generated because their cell values and the design have not changed since their last generation.
+    int numberOfSkipped() const;
+
+    /// Returns the state of the generation of each row. The values are obtained from the FutureStates enum and returned as integers. The array has one entry for each row, in the order of rows.
+    std::vector<int> rowStates() const;
+
+    /// Returns whether the generation of each row was skipped because its inputs have not changed. The array has one entry for each row, in the order of rows.
+    std::vector<bool> isSkipped() const;
+
+    /// Returns the error message of each failed row, or an empty string if the row did not fail or is not complete yet. The array has one entry for each row, in the order of rows.
+    std::vector<std::string> errors() const;
+
+    /// Returns the time in seconds spent generating each row, or 0 if the row was skipped or is not complete yet. The array has one entry for each row, in the order of rows.
+    std::vector<double> durations() const;
+
+    ADSK_FUSION_CONFIGURATIONBATCHFUTURE_API static const char* classType();
+    ADSK_FUSION_CONFIGURATIONBATCHFUTURE_API const char* objectType() const override;
+    ADSK_FUSION_CONFIGURATIONBATCHFUTURE_API void* queryInterface(const char* id) const override;
+    ADSK_FUSION_CONFIGURATIONBATCHFUTURE_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual ConfigurationRow** rows_raw(size_t& return_size) const = 0;
+    virtual int numberOfCompleted_raw() const = 0;
+    virtual int numberOfSkipped_raw() const = 0;
+    virtual int* rowStates_raw(size_t& return_size) const = 0;
+    virtual bool* isSkipped_raw(size_t& return_size) const = 0;
+    virtual char** errors_raw(size_t& return_size) const = 0;
+    virtual double* durations_raw(size_t& return_size) const = 0;
+};
+
+// Inline wrappers
+
+inline std::vector<core::Ptr<ConfigurationRow>> ConfigurationBatchFuture::rows() const
+{
+    std::vector<core::Ptr<ConfigurationRow>> res;
+    size_t s;
+
+    ConfigurationRow** p= rows_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline int ConfigurationBatchFuture::numberOfCompleted() const
+{
+    int res = numberOfCompleted_raw();
+    return res;
+}
+
+inline int ConfigurationBatchFuture::numberOfSkipped() const
+{
+    int res = numberOfSkipped_raw();
+    return res;
+}
+
+inline std::vector<int> ConfigurationBatchFuture::rowStates() const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= rowStates_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<bool> ConfigurationBatchFuture::isSkipped() const
+{
+    std::vector<bool> res;
+    size_t s;
+
+    bool* p= isSkipped_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<std::string> ConfigurationBatchFuture::errors() const
+{
+    std::vector<std::string> res;
+    size_t s;
+
+    char** p= errors_raw(s);
+    if(p)
+    {
+        res.resize(s);
+        for(size_t i=0; i<s; ++i)
+        {
+            char* pChar = p[i];
+            if(pChar)
+                res[i] = pChar;
+            core::DeallocateArray(pChar);
+        }
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> ConfigurationBatchFuture::durations() const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= durations_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+}// namespace fusion
+}// namespace adsk
+
+#undef ADSK_FUSION_CONFIGURATIONBATCHFUTURE_API
\ No newline at end of file
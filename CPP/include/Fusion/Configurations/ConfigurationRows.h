@@ -12,6 +12,7 @@
 #include "../../Core/Base.h"
 #include "../FusionTypeDefs.h"
 #include <string>
+#include <vector>
 
 // THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
 // THIS HEADER FILE WILL BE GENERATED FROM NIDL.
@@ -28,6 +29,7 @@
 #endif
 
 namespace adsk { namespace fusion {
+    class ConfigurationBatchFuture;
     class ConfigurationRow;
 }}
 
@@ -65,6 +67,28 @@ public:
     /// Returns the newly created row.
     core::Ptr<ConfigurationRow> add(const std::string& name);
 
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Generates several rows of the table. Rows are generated at the same time where the model allows it.
+    /// When isUsingCache is true, a row is skipped if it was generated before with the same cell values and the same
+    /// version of the design. The cache is keyed by the id of the row, a hash of its cell values and the revision of the design.
+    /// rows : The rows to generate. The rows must belong to this table.
+    /// maxConcurrency : The maximum number of rows generated at the same time. 0 uses the number of processor cores.
+    /// isUsingCache : Specifies whether rows whose inputs have not changed since their last generation are skipped.
+    /// Returns a future that can be used to follow the generation of each row.
+    /// Null is returned in the case where starting the generation fails.
+    core::Ptr<ConfigurationBatchFuture> generateRows(const std::vector<core::Ptr<ConfigurationRow>>& rows, int maxConcurrency = 0, bool isUsingCache = true);
+
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Clears the cache used by generateRows so the next generation of each row is not skipped.
+    /// Returns true if the cache was cleared.
+    bool clearGenerationCache();
+
     typedef ConfigurationRow iterable_type;
     template <class OutputIterator> void copyTo(OutputIterator result);
 
@@ -81,6 +105,8 @@ private:
     virtual ConfigurationRow* itemByName_raw(const char* name) const = 0;
     virtual size_t count_raw() const = 0;
     virtual ConfigurationRow* add_raw(const char* name) = 0;
+    virtual ConfigurationBatchFuture* generateRows_raw(ConfigurationRow** rows, size_t rows_size, int maxConcurrency, bool isUsingCache) = 0;
+    virtual bool clearGenerationCache_raw() = 0;
 };
 
 // Inline wrappers
@@ -123,6 +149,23 @@ template <class OutputIterator> inline void ConfigurationRows::copyTo(OutputIter
         ++result;
     }
 }
+
+inline core::Ptr<ConfigurationBatchFuture> ConfigurationRows::generateRows(const std::vector<core::Ptr<ConfigurationRow>>& rows, int maxConcurrency, bool isUsingCache)
+{
+    ConfigurationRow** rows_ = new ConfigurationRow*[rows.size()];
+    for(size_t i=0; i<rows.size(); ++i)
+        rows_[i] = rows[i].get();
+
+    core::Ptr<ConfigurationBatchFuture> res = generateRows_raw(rows_, rows.size(), maxConcurrency, isUsingCache);
+    delete[] rows_;
+    return res;
+}
+
+inline bool ConfigurationRows::clearGenerationCache()
+{
+    bool res = clearGenerationCache_raw();
+    return res;
+}
 }// namespace fusion
 }// namespace adsk
 
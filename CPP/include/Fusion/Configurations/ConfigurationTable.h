@@ -30,6 +30,8 @@
 namespace adsk { namespace fusion {
     class ConfigurationCell;
     class ConfigurationRows;
+    class ConfigurationTableData;
+    class ConfigurationTableDifference;
 }}
 
 namespace adsk { namespace fusion {
@@ -49,6 +51,34 @@ public:
     /// row : The index of the row the cell is in. An index of 0 is the first row and does not include the header row.
     core::Ptr<ConfigurationCell> getCell(size_t column, size_t row);
 
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Copies the ids, names and cell values of all columns and rows of this table in a single call.
+    /// Returns the table data or null in the case of failure.
+    core::Ptr<ConfigurationTableData> exportData() const;
+
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Compares table data, typically exported from this table and edited, with the current content of this table.
+    /// data : The table data to compare with. The data must have been exported from this table.
+    /// Returns the minimal cell, row and name changes needed to make the table match the data, or null in the case of failure.
+    core::Ptr<ConfigurationTableDifference> compareData(const core::Ptr<ConfigurationTableData>& data) const;
+
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Applies table data to this table as a single transaction: only the cells, rows and names reported by compareData are
+    /// changed, and all changes are undone together. If a change fails, no change is applied. If the table was obtained from
+    /// a DataFile, this method will fail.
+    /// data : The table data to apply. The data must have been exported from this table.
+    /// Returns true if the data was applied successfully.
+    bool importData(const core::Ptr<ConfigurationTableData>& data);
+
     ADSK_FUSION_CONFIGURATIONTABLE_API static const char* classType();
     ADSK_FUSION_CONFIGURATIONTABLE_API const char* objectType() const override;
     ADSK_FUSION_CONFIGURATIONTABLE_API void* queryInterface(const char* id) const override;
@@ -60,6 +90,9 @@ private:
     virtual char* id_raw() const = 0;
     virtual ConfigurationRows* rows_raw() const = 0;
     virtual ConfigurationCell* getCell_raw(size_t column, size_t row) = 0;
+    virtual ConfigurationTableData* exportData_raw() const = 0;
+    virtual ConfigurationTableDifference* compareData_raw(ConfigurationTableData* data) const = 0;
+    virtual bool importData_raw(ConfigurationTableData* data) = 0;
     virtual void placeholderConfigurationTable0() {}
     virtual void placeholderConfigurationTable1() {}
     virtual void placeholderConfigurationTable2() {}
@@ -86,9 +119,6 @@ private:
     virtual void placeholderConfigurationTable23() {}
     virtual void placeholderConfigurationTable24() {}
     virtual void placeholderConfigurationTable25() {}
-    virtual void placeholderConfigurationTable26() {}
-    virtual void placeholderConfigurationTable27() {}
-    virtual void placeholderConfigurationTable28() {}
 };
 
 // Inline wrappers
@@ -117,6 +147,24 @@ inline core::Ptr<ConfigurationCell> ConfigurationTable::getCell(size_t column, s
     core::Ptr<ConfigurationCell> res = getCell_raw(column, row);
     return res;
 }
+
+inline core::Ptr<ConfigurationTableData> ConfigurationTable::exportData() const
+{
+    core::Ptr<ConfigurationTableData> res = exportData_raw();
+    return res;
+}
+
+inline core::Ptr<ConfigurationTableDifference> ConfigurationTable::compareData(const core::Ptr<ConfigurationTableData>& data) const
+{
+    core::Ptr<ConfigurationTableDifference> res = compareData_raw(data.get());
+    return res;
+}
+
+inline bool ConfigurationTable::importData(const core::Ptr<ConfigurationTableData>& data)
+{
+    bool res = importData_raw(data.get());
+    return res;
+}
 }// namespace fusion
 }// namespace adsk
 
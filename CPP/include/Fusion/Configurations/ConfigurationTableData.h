@@ -0,0 +1,358 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "../../Core/Base.h"
+#include "../FusionTypeDefs.h"
+#include <string>
+#include <vector>
+
+// THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
+// THIS HEADER FILE WILL BE GENERATED FROM NIDL.
+#include "../../Core/OSMacros.h"
+
+#ifdef FUSIONXINTERFACE_EXPORTS
+# ifdef __COMPILING_ADSK_FUSION_CONFIGURATIONTABLEDATA_CPP__
+# define ADSK_FUSION_CONFIGURATIONTABLEDATA_API XI_EXPORT
+# else
+# define ADSK_FUSION_CONFIGURATIONTABLEDATA_API
+# endif
+#else
+# define ADSK_FUSION_CONFIGURATIONTABLEDATA_API XI_IMPORT
+#endif
+
+namespace adsk { namespace fusion {
+
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// A copy of the whole content of a configuration table, taken with a single call of ConfigurationTable.exportData.
+/// The cells are available as a matrix of typed values instead of one object per cell. The data can be edited and
+/// applied back to the table with ConfigurationTable.importData, or compared with the table using ConfigurationTable.compareData.
+/// The data is not updated when the table changes afterwards.
+class ConfigurationTableData : public core::Base {
+public:
+
+    /// Returns the id of the table the data was exported from.
+    std::string tableId() const;
+
+    /// Returns the number of columns, not including the name column.
+    int columnCount() const;
+
+    /// Returns the id of each column.
+    std::vector<std::string> columnIds() const;
+
+    /// Returns the title of each column.
+    std::vector<std::string> columnTitles() const;
+
+    /// Returns the type of each column as the class type of the column object, for example
+    /// "adsk::fusion::ConfigurationParameterColumn".
+    std::vector<std::string> columnTypes() const;
+
+    /// Returns the number of rows, not including the header row.
+    int rowCount() const;
+
+    /// Returns the id of each row. Rows added with addRow have an empty id until the data is imported.
+    std::vector<std::string> rowIds() const;
+
+    /// Gets and sets the name of each row. When setting, the array must have rowCount entries.
+    std::vector<std::string> rowNames() const;
+    bool rowNames(const std::vector<std::string>& value);
+
+    /// Returns the type of the value of each cell. The values are obtained from the ConfigurationCellValueTypes enum and
+    /// returned as integers. The cells are ordered row by row. Parameter cells have their expression as the string value and their value in
+    /// internal units as the numeric value.
+    /// startIndex : The index of the first cell to return, where cell i is in row i / columnCount and column i % columnCount.
+    /// count : The number of cells to return. Use -1 to return all cells from startIndex to the end of the table.
+    /// Returns an array of count values.
+    std::vector<int> valueTypes(int startIndex = 0, int count = -1) const;
+
+    /// Returns the string value of each cell: the text of string cells, the expression of parameter cells and the id of the
+    /// selected choice of enum cells. The entry is empty for boolean cells.
+    /// startIndex : The index of the first cell to return, where cell i is in row i / columnCount and column i % columnCount.
+    /// count : The number of cells to return. Use -1 to return all cells from startIndex to the end of the table.
+    /// Returns an array of count values.
+    std::vector<std::string> stringValues(int startIndex = 0, int count = -1) const;
+
+    /// Returns the numeric value of each cell: the value of double cells in internal units, and 1 for true and 0 for false
+    /// for boolean cells. The entry is 0 for string and enum cells.
+    /// startIndex : The index of the first cell to return, where cell i is in row i / columnCount and column i % columnCount.
+    /// count : The number of cells to return. Use -1 to return all cells from startIndex to the end of the table.
+    /// Returns an array of count values.
+    std::vector<double> numericValues(int startIndex = 0, int count = -1) const;
+
+    /// Sets the values of many cells. For string and enum cells, the string value is used. For double cells, the string value
+    /// is used as the expression if it is not empty, and the numeric value otherwise. For boolean cells, the numeric value is used.
+    /// rowIndices : The row of each cell to set.
+    /// columnIndices : The column of each cell to set. The array must have the same size as rowIndices.
+    /// stringValues : The string value of each cell. The array must have the same size as rowIndices.
+    /// numericValues : The numeric value of each cell. The array must have the same size as rowIndices.
+    /// Returns true if all cells were set. No cell is set if an index is invalid or the arrays differ in size.
+    bool setCells(const std::vector<int>& rowIndices, const std::vector<int>& columnIndices, const std::vector<std::string>& stringValues, const std::vector<double>& numericValues);
+
+    /// Adds a row at the end of the data with the cell values of an existing row.
+    /// name : The name of the new row.
+    /// sourceRowIndex : The index of the row whose cell values are copied.
+    /// Returns the index of the new row or -1 if the source row index is invalid.
+    int addRow(const std::string& name, int sourceRowIndex);
+
+    /// Removes a row from the data. The row is deleted from the table when the data is imported.
+    /// rowIndex : The index of the row to remove.
+    /// Returns true if the row was removed.
+    bool removeRow(int rowIndex);
+
+    ADSK_FUSION_CONFIGURATIONTABLEDATA_API static const char* classType();
+    ADSK_FUSION_CONFIGURATIONTABLEDATA_API const char* objectType() const override;
+    ADSK_FUSION_CONFIGURATIONTABLEDATA_API void* queryInterface(const char* id) const override;
+    ADSK_FUSION_CONFIGURATIONTABLEDATA_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual char* tableId_raw() const = 0;
+    virtual int columnCount_raw() const = 0;
+    virtual char** columnIds_raw(size_t& return_size) const = 0;
+    virtual char** columnTitles_raw(size_t& return_size) const = 0;
+    virtual char** columnTypes_raw(size_t& return_size) const = 0;
+    virtual int rowCount_raw() const = 0;
+    virtual char** rowIds_raw(size_t& return_size) const = 0;
+    virtual char** rowNames_raw(size_t& return_size) const = 0;
+    virtual bool rowNames_raw(const char** value, size_t value_size) = 0;
+    virtual int* valueTypes_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual char** stringValues_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual double* numericValues_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual bool setCells_raw(const int* rowIndices, size_t rowIndices_size, const int* columnIndices, size_t columnIndices_size, const char** stringValues, size_t stringValues_size, const double* numericValues, size_t numericValues_size) = 0;
+    virtual int addRow_raw(const char* name, int sourceRowIndex) = 0;
+    virtual bool removeRow_raw(int rowIndex) = 0;
+};
+
+// Inline wrappers
+
+inline std::string ConfigurationTableData::tableId() const
+{
+    std::string res;
+
+    char* p= tableId_raw();
+    if (p)
+    {
+        res = p;
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline int ConfigurationTableData::columnCount() const
+{
+    int res = columnCount_raw();
+    return res;
+}
+
+inline std::vector<std::string> ConfigurationTableData::columnIds() const
+{
+    std::vector<std::string> res;
+    size_t s;
+
+    char** p= columnIds_raw(s);
+    if(p)
+    {
+        res.resize(s);
+        for(size_t i=0; i<s; ++i)
+        {
+            char* pChar = p[i];
+            if(pChar)
+                res[i] = pChar;
+            core::DeallocateArray(pChar);
+        }
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<std::string> ConfigurationTableData::columnTitles() const
+{
+    std::vector<std::string> res;
+    size_t s;
+
+    char** p= columnTitles_raw(s);
+    if(p)
+    {
+        res.resize(s);
+        for(size_t i=0; i<s; ++i)
+        {
+            char* pChar = p[i];
+            if(pChar)
+                res[i] = pChar;
+            core::DeallocateArray(pChar);
+        }
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<std::string> ConfigurationTableData::columnTypes() const
+{
+    std::vector<std::string> res;
+    size_t s;
+
+    char** p= columnTypes_raw(s);
+    if(p)
+    {
+        res.resize(s);
+        for(size_t i=0; i<s; ++i)
+        {
+            char* pChar = p[i];
+            if(pChar)
+                res[i] = pChar;
+            core::DeallocateArray(pChar);
+        }
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline int ConfigurationTableData::rowCount() const
+{
+    int res = rowCount_raw();
+    return res;
+}
+
+inline std::vector<std::string> ConfigurationTableData::rowIds() const
+{
+    std::vector<std::string> res;
+    size_t s;
+
+    char** p= rowIds_raw(s);
+    if(p)
+    {
+        res.resize(s);
+        for(size_t i=0; i<s; ++i)
+        {
+            char* pChar = p[i];
+            if(pChar)
+                res[i] = pChar;
+            core::DeallocateArray(pChar);
+        }
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<std::string> ConfigurationTableData::rowNames() const
+{
+    std::vector<std::string> res;
+    size_t s;
+
+    char** p= rowNames_raw(s);
+    if(p)
+    {
+        res.resize(s);
+        for(size_t i=0; i<s; ++i)
+        {
+            char* pChar = p[i];
+            if(pChar)
+                res[i] = pChar;
+            core::DeallocateArray(pChar);
+        }
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline bool ConfigurationTableData::rowNames(const std::vector<std::string>& value)
+{
+    const char** value_ = value.empty() ? nullptr : (new const char*[value.size()]);
+    for(size_t i = 0; i < value.size(); ++i)
+    {
+        value_[i] = value[i].c_str();
+    }
+
+    bool res = rowNames_raw(value_, value.size());
+    delete[] value_;
+    return res;
+}
+
+inline std::vector<int> ConfigurationTableData::valueTypes(int startIndex, int count) const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= valueTypes_raw(startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<std::string> ConfigurationTableData::stringValues(int startIndex, int count) const
+{
+    std::vector<std::string> res;
+    size_t s;
+
+    char** p= stringValues_raw(startIndex, count, s);
+    if(p)
+    {
+        res.resize(s);
+        for(size_t i=0; i<s; ++i)
+        {
+            char* pChar = p[i];
+            if(pChar)
+                res[i] = pChar;
+            core::DeallocateArray(pChar);
+        }
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> ConfigurationTableData::numericValues(int startIndex, int count) const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= numericValues_raw(startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline bool ConfigurationTableData::setCells(const std::vector<int>& rowIndices, const std::vector<int>& columnIndices, const std::vector<std::string>& stringValues, const std::vector<double>& numericValues)
+{
+    const char** stringValues_ = stringValues.empty() ? nullptr : (new const char*[stringValues.size()]);
+    for(size_t i = 0; i < stringValues.size(); ++i)
+    {
+        stringValues_[i] = stringValues[i].c_str();
+    }
+
+    bool res = setCells_raw(rowIndices.empty() ? nullptr : &rowIndices[0], rowIndices.size(), columnIndices.empty() ? nullptr : &columnIndices[0], columnIndices.size(), stringValues_, stringValues.size(), numericValues.empty() ? nullptr : &numericValues[0], numericValues.size());
+    delete[] stringValues_;
+    return res;
+}
+
+inline int ConfigurationTableData::addRow(const std::string& name, int sourceRowIndex)
+{
+    int res = addRow_raw(name.c_str(), sourceRowIndex);
+    return res;
+}
+
+inline bool ConfigurationTableData::removeRow(int rowIndex)
+{
+    bool res = removeRow_raw(rowIndex);
+    return res;
+}
+}// namespace fusion
+}// namespace adsk
+
+#undef ADSK_FUSION_CONFIGURATIONTABLEDATA_API
\ No newline at end of file
@@ -0,0 +1,250 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "../../Core/Base.h"
+#include "../FusionTypeDefs.h"
+#include <string>
+#include <vector>
+
+// THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
+// THIS HEADER FILE WILL BE GENERATED FROM NIDL.
+#include "../../Core/OSMacros.h"
+
+#ifdef FUSIONXINTERFACE_EXPORTS
+# ifdef __COMPILING_ADSK_FUSION_CONFIGURATIONTABLEDIFFERENCE_CPP__
+# define ADSK_FUSION_CONFIGURATIONTABLEDIFFERENCE_API XI_EXPORT
+# else
+# define ADSK_FUSION_CONFIGURATIONTABLEDIFFERENCE_API
+# endif
+#else
+# define ADSK_FUSION_CONFIGURATIONTABLEDIFFERENCE_API XI_IMPORT
+#endif
+
+namespace adsk { namespace fusion {
+
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// The minimal changes needed to make a configuration table match a ConfigurationTableData, as returned by
+/// ConfigurationTable.compareData. Rows are matched by id and columns by id.
+class ConfigurationTableDifference : public core::Base {
+public:
+
+    /// Returns true if applying the data would not change the table.
+    bool isEqual() const;
+
+    /// Returns the indices in the data of the rows that do not exist in the table.
+    std::vector<int> addedRowIndices() const;
+
+    /// Returns the ids of the rows that were removed from the data using removeRow and still exist in the table. Rows added
+    /// to the table after the data was exported are not reported and are kept when the data is imported.
+    std::vector<std::string> removedRowIds() const;
+
+    /// Returns the indices in the data of the rows whose name differs from the table.
+    std::vector<int> renamedRowIndices() const;
+
+    /// Returns the row in the data of each changed cell. The array has one entry for each changed cell.
+    std::vector<int> rowIndices() const;
+
+    /// Returns the column in the data of each changed cell. The array has one entry for each changed cell.
+    std::vector<int> columnIndices() const;
+
+    /// Returns the string value in the table of each changed cell. The array has one entry for each changed cell.
+    std::vector<std::string> oldStringValues() const;
+
+    /// Returns the string value in the data of each changed cell. The array has one entry for each changed cell.
+    std::vector<std::string> newStringValues() const;
+
+    /// Returns the numeric value in the table of each changed cell. The array has one entry for each changed cell.
+    std::vector<double> oldNumericValues() const;
+
+    /// Returns the numeric value in the data of each changed cell. The array has one entry for each changed cell.
+    std::vector<double> newNumericValues() const;
+
+    ADSK_FUSION_CONFIGURATIONTABLEDIFFERENCE_API static const char* classType();
+    ADSK_FUSION_CONFIGURATIONTABLEDIFFERENCE_API const char* objectType() const override;
+    ADSK_FUSION_CONFIGURATIONTABLEDIFFERENCE_API void* queryInterface(const char* id) const override;
+    ADSK_FUSION_CONFIGURATIONTABLEDIFFERENCE_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual bool isEqual_raw() const = 0;
+    virtual int* addedRowIndices_raw(size_t& return_size) const = 0;
+    virtual char** removedRowIds_raw(size_t& return_size) const = 0;
+    virtual int* renamedRowIndices_raw(size_t& return_size) const = 0;
+    virtual int* rowIndices_raw(size_t& return_size) const = 0;
+    virtual int* columnIndices_raw(size_t& return_size) const = 0;
+    virtual char** oldStringValues_raw(size_t& return_size) const = 0;
+    virtual char** newStringValues_raw(size_t& return_size) const = 0;
+    virtual double* oldNumericValues_raw(size_t& return_size) const = 0;
+    virtual double* newNumericValues_raw(size_t& return_size) const = 0;
+};
+
+// Inline wrappers
+
+inline bool ConfigurationTableDifference::isEqual() const
+{
+    bool res = isEqual_raw();
+    return res;
+}
+
+inline std::vector<int> ConfigurationTableDifference::addedRowIndices() const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= addedRowIndices_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<std::string> ConfigurationTableDifference::removedRowIds() const
+{
+    std::vector<std::string> res;
+    size_t s;
+
+    char** p= removedRowIds_raw(s);
+    if(p)
+    {
+        res.resize(s);
+        for(size_t i=0; i<s; ++i)
+        {
+            char* pChar = p[i];
+            if(pChar)
+                res[i] = pChar;
+            core::DeallocateArray(pChar);
+        }
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<int> ConfigurationTableDifference::renamedRowIndices() const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= renamedRowIndices_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<int> ConfigurationTableDifference::rowIndices() const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= rowIndices_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<int> ConfigurationTableDifference::columnIndices() const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= columnIndices_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<std::string> ConfigurationTableDifference::oldStringValues() const
+{
+    std::vector<std::string> res;
+    size_t s;
+
+    char** p= oldStringValues_raw(s);
+    if(p)
+    {
+        res.resize(s);
+        for(size_t i=0; i<s; ++i)
+        {
+            char* pChar = p[i];
+            if(pChar)
+                res[i] = pChar;
+            core::DeallocateArray(pChar);
+        }
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<std::string> ConfigurationTableDifference::newStringValues() const
+{
+    std::vector<std::string> res;
+    size_t s;
+
+    char** p= newStringValues_raw(s);
+    if(p)
+    {
+        res.resize(s);
+        for(size_t i=0; i<s; ++i)
+        {
+            char* pChar = p[i];
+            if(pChar)
+                res[i] = pChar;
+            core::DeallocateArray(pChar);
+        }
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> ConfigurationTableDifference::oldNumericValues() const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= oldNumericValues_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> ConfigurationTableDifference::newNumericValues() const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= newNumericValues_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+}// namespace fusion
+}// namespace adsk
+
+#undef ADSK_FUSION_CONFIGURATIONTABLEDIFFERENCE_API
\ No newline at end of file
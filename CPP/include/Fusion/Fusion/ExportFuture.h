@@ -0,0 +1,136 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "../../Core/Application/Future.h"
+#include <string>
+
+// THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
+// THIS HEADER FILE WILL BE GENERATED FROM NIDL.
+#include "../../Core/OSMacros.h"
+
+#ifdef FUSIONXINTERFACE_EXPORTS
+# ifdef __COMPILING_ADSK_FUSION_EXPORTFUTURE_CPP__
+# define ADSK_FUSION_EXPORTFUTURE_API XI_EXPORT
+# else
+# define ADSK_FUSION_EXPORTFUTURE_API
+# endif
+#else
+# define ADSK_FUSION_EXPORTFUTURE_API XI_IMPORT
+#endif
+
+namespace adsk { namespace fusion {
+    class ExportOptions;
+}}
+
+namespace adsk { namespace fusion {
+
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// Used to check the state of an export started with ExportManager.executeAsync or added to an ExportQueue, and to cancel it.
+/// The state of the future is finished once the file is completely written, and failed if the export failed or was cancelled.
+class ExportFuture : public core::Future {
+public:
+
+    /// Returns the export options of the export.
+    core::Ptr<ExportOptions> exportOptions() const;
+
+    /// Returns the progress of the export, from 0 to 1.
+    double progress() const;
+
+    /// Returns the number of bytes written to the export file so far.
+    size_t bytesWritten() const;
+
+    /// Returns the time in seconds spent on the export so far.
+    double duration() const;
+
+    /// Returns true if the export was cancelled.
+    bool isCancelled() const;
+
+    /// Returns the error message if the export failed, or an empty string otherwise.
+    std::string error() const;
+
+    /// Cancels the export. A partially written file is deleted.
+    /// Returns true if the export was cancelled, or false if it is already finished.
+    bool cancel();
+
+    ADSK_FUSION_EXPORTFUTURE_API static const char* classType();
+    ADSK_FUSION_EXPORTFUTURE_API const char* objectType() const override;
+    ADSK_FUSION_EXPORTFUTURE_API void* queryInterface(const char* id) const override;
+    ADSK_FUSION_EXPORTFUTURE_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual ExportOptions* exportOptions_raw() const = 0;
+    virtual double progress_raw() const = 0;
+    virtual size_t bytesWritten_raw() const = 0;
+    virtual double duration_raw() const = 0;
+    virtual bool isCancelled_raw() const = 0;
+    virtual char* error_raw() const = 0;
+    virtual bool cancel_raw() = 0;
+};
+
+// Inline wrappers
+
+inline core::Ptr<ExportOptions> ExportFuture::exportOptions() const
+{
+    core::Ptr<ExportOptions> res = exportOptions_raw();
+    return res;
+}
+
+inline double ExportFuture::progress() const
+{
+    double res = progress_raw();
+    return res;
+}
+
+inline size_t ExportFuture::bytesWritten() const
+{
+    size_t res = bytesWritten_raw();
+    return res;
+}
+
+inline double ExportFuture::duration() const
+{
+    double res = duration_raw();
+    return res;
+}
+
+inline bool ExportFuture::isCancelled() const
+{
+    bool res = isCancelled_raw();
+    return res;
+}
+
+inline std::string ExportFuture::error() const
+{
+    std::string res;
+
+    char* p= error_raw();
+    if (p)
+    {
+        res = p;
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline bool ExportFuture::cancel()
+{
+    bool res = cancel_raw();
+    return res;
+}
+}// namespace fusion
+}// namespace adsk
+
+#undef ADSK_FUSION_EXPORTFUTURE_API
\ No newline at end of file
@@ -31,7 +31,9 @@ namespace adsk { namespace fusion {
     class C3MFExportOptions;
     class DXFFlatPatternExportOptions;
     class DXFSketchExportOptions;
+    class ExportFuture;
     class ExportOptions;
+    class ExportQueue;
     class FlatPattern;
     class FusionArchiveExportOptions;
     class IGESExportOptions;
@@ -161,6 +163,24 @@ public:
     /// The created DXFSketchExportOptions object or null if the creation failed.
     core::Ptr<DXFSketchExportOptions> createDXFSketchExportOptions(const std::string& filename, const core::Ptr<Sketch>& sketch);
 
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Starts an export in the background and returns immediately. Use the returned future to follow the progress of the
+    /// export or to cancel it.
+    /// exportOptions : The export options that define the export, created with one of the create methods of the ExportManager.
+    /// Returns the future of the export or null if the export could not be started.
+    core::Ptr<ExportFuture> executeAsync(const core::Ptr<ExportOptions>& exportOptions);
+
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Creates an empty queue to run many exports in the background.
+    /// Returns the newly created export queue.
+    core::Ptr<ExportQueue> createExportQueue();
+
     ADSK_FUSION_EXPORTMANAGER_API static const char* classType();
     ADSK_FUSION_EXPORTMANAGER_API const char* objectType() const override;
     ADSK_FUSION_EXPORTMANAGER_API void* queryInterface(const char* id) const override;
@@ -181,6 +201,8 @@ private:
     virtual OBJExportOptions* createOBJExportOptions_raw(core::Base* geometry, const char* filename) = 0;
     virtual DXFFlatPatternExportOptions* createDXFFlatPatternExportOptions_raw(const char* filename, FlatPattern* flatPattern) = 0;
     virtual DXFSketchExportOptions* createDXFSketchExportOptions_raw(const char* filename, Sketch* sketch) = 0;
+    virtual ExportFuture* executeAsync_raw(ExportOptions* exportOptions) = 0;
+    virtual ExportQueue* createExportQueue_raw() = 0;
 };
 
 // Inline wrappers
@@ -256,6 +278,18 @@ inline core::Ptr<DXFSketchExportOptions> ExportManager::createDXFSketchExportOpt
     core::Ptr<DXFSketchExportOptions> res = createDXFSketchExportOptions_raw(filename.c_str(), sketch.get());
     return res;
 }
+
+inline core::Ptr<ExportFuture> ExportManager::executeAsync(const core::Ptr<ExportOptions>& exportOptions)
+{
+    core::Ptr<ExportFuture> res = executeAsync_raw(exportOptions.get());
+    return res;
+}
+
+inline core::Ptr<ExportQueue> ExportManager::createExportQueue()
+{
+    core::Ptr<ExportQueue> res = createExportQueue_raw();
+    return res;
+}
 }// namespace fusion
 }// namespace adsk
 
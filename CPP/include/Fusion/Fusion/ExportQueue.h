@@ -0,0 +1,249 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "../../Core/Base.h"
+#include <string>
+#include <vector>
+
+// THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
+// THIS HEADER FILE WILL BE GENERATED FROM NIDL.
+#include "../../Core/OSMacros.h"
+
+#ifdef FUSIONXINTERFACE_EXPORTS
+# ifdef __COMPILING_ADSK_FUSION_EXPORTQUEUE_CPP__
+# define ADSK_FUSION_EXPORTQUEUE_API XI_EXPORT
+# else
+# define ADSK_FUSION_EXPORTQUEUE_API
+# endif
+#else
+# define ADSK_FUSION_EXPORTQUEUE_API XI_IMPORT
+#endif
+
+namespace adsk { namespace fusion {
+    class ExportFuture;
+    class ExportOptions;
+}}
+
+namespace adsk { namespace fusion {
+
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// Runs many exports in the background with a bounded number of exports at the same time.
+/// Use the ExportManager.createExportQueue method to create a queue, add the export options with add and call start.
+/// Mesh exports (STL, OBJ and 3MF) of the same geometry with the same refinement settings share a single tessellation,
+/// and files are written by background threads while the next exports are prepared.
+class ExportQueue : public core::Base {
+public:
+
+    /// Adds an export to the queue. Exports are started in the order they are added.
+    /// exportOptions : The export options that define the export, created with one of the create methods of the ExportManager.
+    /// Returns the future of the export or null if the export options are invalid.
+    core::Ptr<ExportFuture> add(const core::Ptr<ExportOptions>& exportOptions);
+
+    /// Gets and sets the maximum number of exports running at the same time. 0 uses the number of processor cores.
+    /// Defaults to 0. It cannot be changed once the queue is started.
+    int maxConcurrency() const;
+    bool maxConcurrency(int value);
+
+    /// Gets and sets whether mesh exports of the same geometry with the same refinement settings share a single tessellation.
+    /// Defaults to true. It cannot be changed once the queue is started.
+    bool isSharingTessellation() const;
+    bool isSharingTessellation(bool value);
+
+    /// Starts running the exports of the queue in the background. Exports added afterwards are started as soon as possible.
+    /// Returns true if the queue was started.
+    bool start();
+
+    /// Cancels all exports of the queue that are not finished yet.
+    /// Returns true if the exports were cancelled.
+    bool cancel();
+
+    /// Returns the futures of all exports of the queue, in the order they were added.
+    std::vector<core::Ptr<ExportFuture>> futures() const;
+
+    /// Returns the number of exports that are finished, failed or cancelled.
+    int numberOfCompleted() const;
+
+    /// Returns true if all exports of the queue are finished, failed or cancelled.
+    bool isCompleted() const;
+
+    /// Returns the formats exported by the queue, as the class type of their export options, for example "adsk::fusion::STLExportOptions".
+    std::vector<std::string> formatNames() const;
+
+    /// Returns the number of files written for each format. The array has one entry for each format, in the same order as formatNames.
+    std::vector<int> formatFileCounts() const;
+
+    /// Returns the number of bytes written for each format. The array has one entry for each format, in the same order as formatNames.
+    std::vector<size_t> formatBytesWritten() const;
+
+    /// Returns the time in seconds spent on the exports of each format. The array has one entry for each format, in the same order as formatNames.
+    std::vector<double> formatDurations() const;
+
+    ADSK_FUSION_EXPORTQUEUE_API static const char* classType();
+    ADSK_FUSION_EXPORTQUEUE_API const char* objectType() const override;
+    ADSK_FUSION_EXPORTQUEUE_API void* queryInterface(const char* id) const override;
+    ADSK_FUSION_EXPORTQUEUE_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual ExportFuture* add_raw(ExportOptions* exportOptions) = 0;
+    virtual int maxConcurrency_raw() const = 0;
+    virtual bool maxConcurrency_raw(int value) = 0;
+    virtual bool isSharingTessellation_raw() const = 0;
+    virtual bool isSharingTessellation_raw(bool value) = 0;
+    virtual bool start_raw() = 0;
+    virtual bool cancel_raw() = 0;
+    virtual ExportFuture** futures_raw(size_t& return_size) const = 0;
+    virtual int numberOfCompleted_raw() const = 0;
+    virtual bool isCompleted_raw() const = 0;
+    virtual char** formatNames_raw(size_t& return_size) const = 0;
+    virtual int* formatFileCounts_raw(size_t& return_size) const = 0;
+    virtual size_t* formatBytesWritten_raw(size_t& return_size) const = 0;
+    virtual double* formatDurations_raw(size_t& return_size) const = 0;
+};
+
+// Inline wrappers
+
+inline core::Ptr<ExportFuture> ExportQueue::add(const core::Ptr<ExportOptions>& exportOptions)
+{
+    core::Ptr<ExportFuture> res = add_raw(exportOptions.get());
+    return res;
+}
+
+inline int ExportQueue::maxConcurrency() const
+{
+    int res = maxConcurrency_raw();
+    return res;
+}
+
+inline bool ExportQueue::maxConcurrency(int value)
+{
+    return maxConcurrency_raw(value);
+}
+
+inline bool ExportQueue::isSharingTessellation() const
+{
+    bool res = isSharingTessellation_raw();
+    return res;
+}
+
+inline bool ExportQueue::isSharingTessellation(bool value)
+{
+    return isSharingTessellation_raw(value);
+}
+
+inline bool ExportQueue::start()
+{
+    bool res = start_raw();
+    return res;
+}
+
+inline bool ExportQueue::cancel()
+{
+    bool res = cancel_raw();
+    return res;
+}
+
+inline std::vector<core::Ptr<ExportFuture>> ExportQueue::futures() const
+{
+    std::vector<core::Ptr<ExportFuture>> res;
+    size_t s;
+
+    ExportFuture** p= futures_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline int ExportQueue::numberOfCompleted() const
+{
+    int res = numberOfCompleted_raw();
+    return res;
+}
+
+inline bool ExportQueue::isCompleted() const
+{
+    bool res = isCompleted_raw();
+    return res;
+}
+
+inline std::vector<std::string> ExportQueue::formatNames() const
+{
+    std::vector<std::string> res;
+    size_t s;
+
+    char** p= formatNames_raw(s);
+    if(p)
+    {
+        res.resize(s);
+        for(size_t i=0; i<s; ++i)
+        {
+            char* pChar = p[i];
+            if(pChar)
+                res[i] = pChar;
+            core::DeallocateArray(pChar);
+        }
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<int> ExportQueue::formatFileCounts() const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= formatFileCounts_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<size_t> ExportQueue::formatBytesWritten() const
+{
+    std::vector<size_t> res;
+    size_t s;
+
+    size_t* p= formatBytesWritten_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> ExportQueue::formatDurations() const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= formatDurations_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+}// namespace fusion
+}// namespace adsk
+
+#undef ADSK_FUSION_EXPORTQUEUE_API
\ No newline at end of file
@@ -10,6 +10,7 @@
 
 #pragma once
 #include "ExportOptions.h"
+#include <string>
 
 // THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
 // THIS HEADER FILE WILL BE GENERATED FROM NIDL.
@@ -31,6 +32,48 @@ namespace adsk { namespace fusion {
 class USDExportOptions : public ExportOptions {
 public:
 
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Gets and sets whether the export writes the stage as separate layers so that later exports only rewrite what changed.
+    /// When true, the file specified by filename is a root layer that references one layer per component, and the meshes
+    /// of the bodies of each component are written as payloads. The component layers are written into a folder named like
+    /// the file with "_layers" appended, next to the file. The revisionId of each component and the entityToken of each
+    /// occurrence are stored in a manifest, and the next incremental export to the same file only rewrites the layers of
+    /// the components whose revisionId changed and the transforms of the occurrences that moved. Layers of deleted
+    /// components are removed. Defaults to false.
+    bool isIncremental() const;
+    bool isIncremental(bool value);
+
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Gets and sets the full path of the manifest used by incremental exports. If the manifest does not exist or does not
+    /// match the exported design, all layers are written. An empty string, which is the default, uses a file named like
+    /// the exported file with ".manifest.json" appended.
+    std::string manifestFilename() const;
+    bool manifestFilename(const std::string& value);
+
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Gets and sets whether the occurrences of a component that is used several times are written as instances of a single
+    /// prototype instead of repeating its meshes. Defaults to true.
+    bool isInstancing() const;
+    bool isInstancing(bool value);
+
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Gets and sets whether the points of the meshes are written with double precision. Single precision points, which
+    /// are the default, halve the size of the meshes and are sufficient for visualization.
+    bool isUsingDoublePrecisionPoints() const;
+    bool isUsingDoublePrecisionPoints(bool value);
+
     ADSK_FUSION_USDEXPORTOPTIONS_API static const char* classType();
     ADSK_FUSION_USDEXPORTOPTIONS_API const char* objectType() const override;
     ADSK_FUSION_USDEXPORTOPTIONS_API void* queryInterface(const char* id) const override;
@@ -39,12 +82,68 @@ public:
 private:
 
     // Raw interface
-
+    virtual bool isIncremental_raw() const = 0;
+    virtual bool isIncremental_raw(bool value) = 0;
+    virtual char* manifestFilename_raw() const = 0;
+    virtual bool manifestFilename_raw(const char* value) = 0;
+    virtual bool isInstancing_raw() const = 0;
+    virtual bool isInstancing_raw(bool value) = 0;
+    virtual bool isUsingDoublePrecisionPoints_raw() const = 0;
+    virtual bool isUsingDoublePrecisionPoints_raw(bool value) = 0;
 };
 
 // Inline wrappers
 
+inline bool USDExportOptions::isIncremental() const
+{
+    bool res = isIncremental_raw();
+    return res;
+}
+
+inline bool USDExportOptions::isIncremental(bool value)
+{
+    return isIncremental_raw(value);
+}
+
+inline std::string USDExportOptions::manifestFilename() const
+{
+    std::string res;
+
+    char* p= manifestFilename_raw();
+    if (p)
+    {
+        res = p;
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline bool USDExportOptions::manifestFilename(const std::string& value)
+{
+    return manifestFilename_raw(value.c_str());
+}
+
+inline bool USDExportOptions::isInstancing() const
+{
+    bool res = isInstancing_raw();
+    return res;
+}
+
+inline bool USDExportOptions::isInstancing(bool value)
+{
+    return isInstancing_raw(value);
+}
+
+inline bool USDExportOptions::isUsingDoublePrecisionPoints() const
+{
+    bool res = isUsingDoublePrecisionPoints_raw();
+    return res;
+}
 
+inline bool USDExportOptions::isUsingDoublePrecisionPoints(bool value)
+{
+    return isUsingDoublePrecisionPoints_raw(value);
+}
 }// namespace fusion
 }// namespace adsk
 
@@ -54,6 +54,8 @@
 #include <Fusion/Fusion/ZebraAnalyses.h>
 #include <Fusion/Fusion/Analysis.h>
 #include <Fusion/Fusion/FusionDefaultUnitsPreferences.h>
+#include <Fusion/Fusion/ExportFuture.h>
+#include <Fusion/Fusion/ExportQueue.h>
 #include <Fusion/Configurations/ConfigurationFuture.h>
 #include <Fusion/Configurations/ConfigurationRows.h>
 #include <Fusion/Configurations/ConfigurationMaterialTable.h>
@@ -103,6 +105,9 @@
 #include <Fusion/Configurations/ConfigurationMaterialColumns.h>
 #include <Fusion/Configurations/ConfigurationReplaceDesign.h>
 #include <Fusion/Configurations/ConfigurationJointSnapCell.h>
+#include <Fusion/Configurations/ConfigurationTableData.h>
+#include <Fusion/Configurations/ConfigurationTableDifference.h>
+#include <Fusion/Configurations/ConfigurationBatchFuture.h>
 #include <Fusion/MeshData/TriangleMeshCalculator.h>
 #include <Fusion/MeshData/TriangleMeshList.h>
 #include <Fusion/MeshData/TextureImage.h>
@@ -382,6 +387,8 @@
 #include <Fusion/Render/Rendering.h>
 #include <Fusion/Render/RenderFuture.h>
 #include <Fusion/Render/SceneSettings.h>
+#include <Fusion/Render/RenderBatch.h>
+#include <Fusion/Render/RenderBatchEvents.h>
 #include <Fusion/Image/Decal.h>
 #include <Fusion/Image/DecalInput.h>
 #include <Fusion/Image/Canvases.h>
@@ -544,6 +551,7 @@
 #include <Fusion/Arrange/Arrange3DEnvelopeInput.h>
 #include <Fusion/Arrange/ArrangeComponents.h>
 #include <Fusion/Arrange/ArrangeProfileOrFaceEnvelopeDefinition.h>
+#include <Fusion/Arrange/Arrange3DPackingResult.h>
 #include <Fusion/SheetMetal/SheetMetalRuleValue.h>
 #include <Fusion/SheetMetal/HemFeature.h>
 #include <Fusion/SheetMetal/FlatPatternProduct.h>
@@ -12,6 +12,34 @@
 
 namespace adsk { namespace fusion {
 
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// Defines the rotations allowed for the parts of a 3D arrangement.
+enum Arrange3DRotationTypes
+{
+    /// The parts keep their orientation.
+    NoneArrange3DRotationType,
+    /// The parts can be rotated about the Z axis of the envelope in steps of 90 degrees.
+    BuildAxisArrange3DRotationType,
+    /// The parts can be rotated into any of the 24 orientations that keep their axes aligned with the axes of the envelope.
+    AxisAlignedArrange3DRotationType
+};
+
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// Defines how the shape of the parts is approximated by a 3D arrangement.
+enum Arrange3DShapeTypes
+{
+    /// The bounding box of each part is used to arrange the parts.
+    BoundingBoxArrange3DShapeType,
+    /// A voxel approximation of the shape of each part is used, which allows parts to nest into each other.
+    VoxelArrange3DShapeType
+};
+
 /// Defines the different types of arrange priorities that are supported.
 enum ArrangePriorities
 {
@@ -302,6 +330,23 @@ enum CoilFeatureTypes
     SpiralCoilFeatureType
 };
 
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// The types of the values of the cells of a configuration table as reported by ConfigurationTableData.
+enum ConfigurationCellValueTypes
+{
+    /// The value is a string, like the value of a property cell or the expression of a parameter cell.
+    StringConfigurationCellValueType,
+    /// The value is a number, like the value of a parameter cell in internal units.
+    DoubleConfigurationCellValueType,
+    /// The value is a boolean, like the state of a suppress or visibility cell.
+    BooleanConfigurationCellValueType,
+    /// The value is one of several choices identified by a string id, like the row of a theme table, a material or an appearance.
+    EnumConfigurationCellValueType
+};
+
 /// Enum that defines the valid combinations of clearance hole columns that can be configured.
 enum ConfigurationClearanceHoleColumns
 {
@@ -0,0 +1,297 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "../../Core/Base.h"
+#include <string>
+#include <vector>
+
+// THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
+// THIS HEADER FILE WILL BE GENERATED FROM NIDL.
+#include "../../Core/OSMacros.h"
+
+#ifdef FUSIONXINTERFACE_EXPORTS
+# ifdef __COMPILING_ADSK_FUSION_RENDERBATCH_CPP__
+# define ADSK_FUSION_RENDERBATCH_API XI_EXPORT
+# else
+# define ADSK_FUSION_RENDERBATCH_API
+# endif
+#else
+# define ADSK_FUSION_RENDERBATCH_API XI_IMPORT
+#endif
+
+namespace adsk { namespace core {
+    class Camera;
+}}
+namespace adsk { namespace fusion {
+    class RenderBatchJobEvent;
+}}
+
+namespace adsk { namespace fusion {
+
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// Renders many images of components or occurrences in the background, for instance to create catalogue images.
+/// Use the Rendering.createRenderBatch method to create a batch, add the jobs with addJob and call start.
+/// The scene settings and the environment of the design are set up once and shared by all jobs, and the images are
+/// encoded and written by worker threads while the next jobs are rendered. Use the jobCompleted event to be notified
+/// of each finished job instead of polling.
+class RenderBatch : public core::Base {
+public:
+
+    /// Adds a job to the batch. Only the specified component or occurrence is visible in the image of the job.
+    /// target : The Component or Occurrence to render.
+    /// camera : The camera that defines the view of the image. If null, the camera of the active viewport is used.
+    /// width : The width of the image in pixels.
+    /// height : The height of the image in pixels.
+    /// filename : The full path and filename of the file to write the image to. The file extension can be .png, .jpg, .jpeg,
+    /// .tif, .tiff or .bmp and the file will be saved as that type.
+    /// Returns the index of the job or -1 if the job is invalid.
+    int addJob(const core::Ptr<core::Base>& target, const core::Ptr<core::Camera>& camera, int width, int height, const std::string& filename);
+
+    /// Gets and sets whether the images are captured from the graphics like Component.createThumbnail instead of being ray traced
+    /// like Rendering.startLocalRender. Thumbnails are much faster, and renderQuality is ignored for them. Defaults to false.
+    bool isThumbnail() const;
+    bool isThumbnail(bool value);
+
+    /// Gets and sets the desired quality of the ray traced images, from 25 to 100 as for Rendering.renderQuality.
+    /// Defaults to the renderQuality of the Rendering the batch was created from.
+    int renderQuality() const;
+    bool renderQuality(int value);
+
+    /// Gets and sets whether the background of the images is transparent. Defaults to the isBackgroundTransparent of the
+    /// Rendering the batch was created from.
+    bool isBackgroundTransparent() const;
+    bool isBackgroundTransparent(bool value);
+
+    /// Gets and sets the maximum number of images encoded and written at the same time. 0 uses the number of processor cores.
+    /// Defaults to 0.
+    int maxConcurrency() const;
+    bool maxConcurrency(int value);
+
+    /// Starts rendering the jobs in the background in the order they were added.
+    /// Returns true if the batch was started.
+    bool start();
+
+    /// Cancels the jobs that are not finished yet. A cancelled job ends in the FailedLocalRenderState state with isCancelled
+    /// set to true and no error, and the jobCompleted event fires for it like for any other failed job.
+    /// Returns true if the jobs were cancelled.
+    bool cancel();
+
+    /// The jobCompleted event fires each time a job has finished: once its image file is written, when it failed or when it was
+    /// cancelled.
+    core::Ptr<RenderBatchJobEvent> jobCompleted() const;
+
+    /// Returns the number of jobs in the batch.
+    int jobCount() const;
+
+    /// Returns the number of jobs that are finished, including the failed ones.
+    int numberOfCompleted() const;
+
+    /// Returns true if all jobs are finished.
+    bool isCompleted() const;
+
+    /// Returns the state of each job. The values are obtained from the LocalRenderStates enum and returned as integers. Cancelled jobs report FailedLocalRenderState; use isCancelled to tell them from the jobs that failed. The array has one entry for each job, in the order the jobs were added.
+    std::vector<int> jobStates() const;
+
+    /// Returns whether each job was cancelled by the cancel method before it finished. The array has one entry for each job, in the order the jobs were added.
+    std::vector<bool> isCancelled() const;
+
+    /// Returns the error message of each failed job, or an empty string for the jobs that succeeded, were cancelled or are not finished. The array has one entry for each job, in the order the jobs were added.
+    std::vector<std::string> errors() const;
+
+    /// Returns the time in seconds spent rendering and writing the image of each job, or 0 if the job is not finished. The array has one entry for each job, in the order the jobs were added.
+    std::vector<double> durations() const;
+
+    ADSK_FUSION_RENDERBATCH_API static const char* classType();
+    ADSK_FUSION_RENDERBATCH_API const char* objectType() const override;
+    ADSK_FUSION_RENDERBATCH_API void* queryInterface(const char* id) const override;
+    ADSK_FUSION_RENDERBATCH_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual int addJob_raw(core::Base* target, core::Camera* camera, int width, int height, const char* filename) = 0;
+    virtual bool isThumbnail_raw() const = 0;
+    virtual bool isThumbnail_raw(bool value) = 0;
+    virtual int renderQuality_raw() const = 0;
+    virtual bool renderQuality_raw(int value) = 0;
+    virtual bool isBackgroundTransparent_raw() const = 0;
+    virtual bool isBackgroundTransparent_raw(bool value) = 0;
+    virtual int maxConcurrency_raw() const = 0;
+    virtual bool maxConcurrency_raw(int value) = 0;
+    virtual bool start_raw() = 0;
+    virtual bool cancel_raw() = 0;
+    virtual RenderBatchJobEvent* jobCompleted_raw() const = 0;
+    virtual int jobCount_raw() const = 0;
+    virtual int numberOfCompleted_raw() const = 0;
+    virtual bool isCompleted_raw() const = 0;
+    virtual int* jobStates_raw(size_t& return_size) const = 0;
+    virtual bool* isCancelled_raw(size_t& return_size) const = 0;
+    virtual char** errors_raw(size_t& return_size) const = 0;
+    virtual double* durations_raw(size_t& return_size) const = 0;
+};
+
+// Inline wrappers
+
+inline int RenderBatch::addJob(const core::Ptr<core::Base>& target, const core::Ptr<core::Camera>& camera, int width, int height, const std::string& filename)
+{
+    int res = addJob_raw(target.get(), camera.get(), width, height, filename.c_str());
+    return res;
+}
+
+inline bool RenderBatch::isThumbnail() const
+{
+    bool res = isThumbnail_raw();
+    return res;
+}
+
+inline bool RenderBatch::isThumbnail(bool value)
+{
+    return isThumbnail_raw(value);
+}
+
+inline int RenderBatch::renderQuality() const
+{
+    int res = renderQuality_raw();
+    return res;
+}
+
+inline bool RenderBatch::renderQuality(int value)
+{
+    return renderQuality_raw(value);
+}
+
+inline bool RenderBatch::isBackgroundTransparent() const
+{
+    bool res = isBackgroundTransparent_raw();
+    return res;
+}
+
+inline bool RenderBatch::isBackgroundTransparent(bool value)
+{
+    return isBackgroundTransparent_raw(value);
+}
+
+inline int RenderBatch::maxConcurrency() const
+{
+    int res = maxConcurrency_raw();
+    return res;
+}
+
+inline bool RenderBatch::maxConcurrency(int value)
+{
+    return maxConcurrency_raw(value);
+}
+
+inline bool RenderBatch::start()
+{
+    bool res = start_raw();
+    return res;
+}
+
+inline bool RenderBatch::cancel()
+{
+    bool res = cancel_raw();
+    return res;
+}
+
+inline core::Ptr<RenderBatchJobEvent> RenderBatch::jobCompleted() const
+{
+    core::Ptr<RenderBatchJobEvent> res = jobCompleted_raw();
+    return res;
+}
+
+inline int RenderBatch::jobCount() const
+{
+    int res = jobCount_raw();
+    return res;
+}
+
+inline int RenderBatch::numberOfCompleted() const
+{
+    int res = numberOfCompleted_raw();
+    return res;
+}
+
+inline bool RenderBatch::isCompleted() const
+{
+    bool res = isCompleted_raw();
+    return res;
+}
+
+inline std::vector<int> RenderBatch::jobStates() const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= jobStates_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<bool> RenderBatch::isCancelled() const
+{
+    std::vector<bool> res;
+    size_t s;
+
+    bool* p= isCancelled_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<std::string> RenderBatch::errors() const
+{
+    std::vector<std::string> res;
+    size_t s;
+
+    char** p= errors_raw(s);
+    if(p)
+    {
+        res.resize(s);
+        for(size_t i=0; i<s; ++i)
+        {
+            char* pChar = p[i];
+            if(pChar)
+                res[i] = pChar;
+            core::DeallocateArray(pChar);
+        }
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<double> RenderBatch::durations() const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= durations_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+}// namespace fusion
+}// namespace adsk
+
+#undef ADSK_FUSION_RENDERBATCH_API
\ No newline at end of file
@@ -0,0 +1,201 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "../../Core/Application/Events.h"
+#include "../../Core/Application/EventHandler.h"
+#include <string>
+
+// THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
+// THIS HEADER FILE WILL BE GENERATED FROM NIDL.
+#include "../../Core/OSMacros.h"
+
+#ifdef FUSIONXINTERFACE_EXPORTS
+# ifdef __COMPILING_RENDERBATCHEVENTS_CPP__
+# define RENDERBATCHEVENTS_API XI_EXPORT
+# else
+# define RENDERBATCHEVENTS_API
+# endif
+#else
+# define RENDERBATCHEVENTS_API XI_IMPORT
+#endif
+
+namespace adsk { namespace fusion {
+    class RenderBatch;
+    class RenderBatchJobEventArgs;
+    class RenderBatchJobEventHandler;
+}}
+
+namespace adsk { namespace fusion {
+
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// A RenderBatchJobEvent represents the completion of a single job of a RenderBatch.
+/// It is used by the RenderBatch.jobCompleted event.
+class RenderBatchJobEvent : public core::Event {
+public:
+
+    /// Add a handler to be notified when the event occurs.
+    /// handler : The handler object to be called when this event is fired.
+    /// Returns true if the addition of the handler was successful.
+    bool add(RenderBatchJobEventHandler* handler);
+
+    /// Removes a handler from the event.
+    /// handler : The handler object to be removed from the event.
+    /// Returns true if removal of the handler was successful.
+    bool remove(RenderBatchJobEventHandler* handler);
+
+    RENDERBATCHEVENTS_API static const char* classType();
+    RENDERBATCHEVENTS_API const char* objectType() const override;
+    RENDERBATCHEVENTS_API void* queryInterface(const char* id) const override;
+    RENDERBATCHEVENTS_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual bool add_raw(RenderBatchJobEventHandler* handler) = 0;
+    virtual bool remove_raw(RenderBatchJobEventHandler* handler) = 0;
+};
+
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// The RenderBatchJobEventArgs provides information about a job of a RenderBatch that has finished.
+class RenderBatchJobEventArgs : public core::EventArgs {
+public:
+
+    /// Returns the render batch the job belongs to.
+    core::Ptr<RenderBatch> renderBatch() const;
+
+    /// Returns the index of the job, in the order the jobs were added to the batch.
+    int jobIndex() const;
+
+    /// Returns true if the image of the job was written successfully.
+    bool isSuccess() const;
+
+    /// Returns true if the job was cancelled by RenderBatch.cancel before it finished. isSuccess is then false and error is empty.
+    bool isCancelled() const;
+
+    /// Returns the full path of the image file of the job.
+    std::string filename() const;
+
+    /// Returns the error message if the job failed, or an empty string if it succeeded or was cancelled.
+    std::string error() const;
+
+    /// Returns the number of jobs of the batch that are finished, including this one.
+    int numberOfCompleted() const;
+
+    RENDERBATCHEVENTS_API static const char* classType();
+    RENDERBATCHEVENTS_API const char* objectType() const override;
+    RENDERBATCHEVENTS_API void* queryInterface(const char* id) const override;
+    RENDERBATCHEVENTS_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual RenderBatch* renderBatch_raw() const = 0;
+    virtual int jobIndex_raw() const = 0;
+    virtual bool isSuccess_raw() const = 0;
+    virtual bool isCancelled_raw() const = 0;
+    virtual char* filename_raw() const = 0;
+    virtual char* error_raw() const = 0;
+    virtual int numberOfCompleted_raw() const = 0;
+};
+
+/// !!!!! Warning !!!!!
+/// ! This is in preview state; please see the help for more info
+/// !!!!! Warning !!!!!
+/// 
+/// The RenderBatchJobEventHandler is a client implemented class that can be added as a handler to a
+/// RenderBatchJobEvent.
+class RenderBatchJobEventHandler : public core::EventHandler {
+public:
+
+    /// The function called by Fusion when the associated event is fired.
+    /// eventArgs : Returns an object that provides access to additional information associated with the event.
+    RENDERBATCHEVENTS_API virtual void notify(const core::Ptr<RenderBatchJobEventArgs>& eventArgs) = 0;
+};
+
+// Inline wrappers
+
+inline bool RenderBatchJobEvent::add(RenderBatchJobEventHandler* handler)
+{
+    bool res = add_raw(handler);
+    return res;
+}
+
+inline bool RenderBatchJobEvent::remove(RenderBatchJobEventHandler* handler)
+{
+    bool res = remove_raw(handler);
+    return res;
+}
+
+inline core::Ptr<RenderBatch> RenderBatchJobEventArgs::renderBatch() const
+{
+    core::Ptr<RenderBatch> res = renderBatch_raw();
+    return res;
+}
+
+inline int RenderBatchJobEventArgs::jobIndex() const
+{
+    int res = jobIndex_raw();
+    return res;
+}
+
+inline bool RenderBatchJobEventArgs::isSuccess() const
+{
+    bool res = isSuccess_raw();
+    return res;
+}
+
+inline bool RenderBatchJobEventArgs::isCancelled() const
+{
+    bool res = isCancelled_raw();
+    return res;
+}
+
+inline std::string RenderBatchJobEventArgs::filename() const
+{
+    std::string res;
+
+    char* p= filename_raw();
+    if (p)
+    {
+        res = p;
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::string RenderBatchJobEventArgs::error() const
+{
+    std::string res;
+
+    char* p= error_raw();
+    if (p)
+    {
+        res = p;
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline int RenderBatchJobEventArgs::numberOfCompleted() const
+{
+    int res = numberOfCompleted_raw();
+    return res;
+}
+}// namespace fusion
+}// namespace adsk
+
+#undef RENDERBATCHEVENTS_API
\ No newline at end of file
@@ -31,6 +31,7 @@ namespace adsk { namespace core {
     class Camera;
 }}
 namespace adsk { namespace fusion {
+    class RenderBatch;
     class RenderFuture;
 }}
 
@@ -91,6 +92,14 @@ public:
     /// Returns a RenderFuture that allows you to check the current state of this rendering job.
     core::Ptr<RenderFuture> startLocalRender(const std::string& filename = "", const core::Ptr<core::Camera>& camera = NULL);
 
+    /// !!!!! Warning !!!!!
+    /// ! This is in preview state; please see the help for more info
+    /// !!!!! Warning !!!!!
+    /// 
+    /// Creates an empty batch to render many images of components or occurrences in the background with a shared scene setup.
+    /// Returns the newly created render batch.
+    core::Ptr<RenderBatch> createRenderBatch();
+
     ADSK_FUSION_RENDERING_API static const char* classType();
     ADSK_FUSION_RENDERING_API const char* objectType() const override;
     ADSK_FUSION_RENDERING_API void* queryInterface(const char* id) const override;
@@ -112,6 +121,7 @@ private:
     virtual int resolutionWidth_raw() const = 0;
     virtual bool resolutionWidth_raw(int value) = 0;
     virtual RenderFuture* startLocalRender_raw(const char* filename, core::Camera* camera) = 0;
+    virtual RenderBatch* createRenderBatch_raw() = 0;
 };
 
 // Inline wrappers
@@ -187,6 +197,12 @@ inline core::Ptr<RenderFuture> Rendering::startLocalRender(const std::string& fi
     core::Ptr<RenderFuture> res = startLocalRender_raw(filename.c_str(), camera.get());
     return res;
 }
+
+inline core::Ptr<RenderBatch> Rendering::createRenderBatch()
+{
+    core::Ptr<RenderBatch> res = createRenderBatch_raw();
+    return res;
+}
 }// namespace fusion
 }// namespace adsk
 
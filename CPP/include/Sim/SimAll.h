@@ -11,3 +11,5 @@
 #include <Sim/Simulation/ConstraintMask.h>
 #include <Sim/Simulation/LoadCaseItems.h>
 #include <Sim/Simulation/SimulationModel.h>
+#include <Sim/Simulation/SimulationMeshInput.h>
+#include <Sim/Simulation/SimulationMesh.h>
@@ -44,6 +44,28 @@ enum LoadDirectionTypes
     ReferenceLoadDirectionType
 };
 
+/// Simulation mesh element types.
+enum MeshElementTypes
+{
+    /// Solid tetrahedral elements with 4 corner nodes.
+    LinearTetrahedronMeshElementType,
+    /// Solid tetrahedral elements with 4 corner nodes and 6 midside nodes.
+    QuadraticTetrahedronMeshElementType,
+    /// Surface triangle elements with 3 corner nodes.
+    LinearTriangleMeshElementType
+};
+
+/// The kinds of the load and constraint sets of a simulation mesh.
+enum MeshSetTypes
+{
+    /// The set is a structural constraint. Its constraint type is reported separately.
+    ConstraintMeshSetType,
+    /// The set is a force load.
+    ForceLoadMeshSetType,
+    /// The set is a load of another kind.
+    OtherLoadMeshSetType
+};
+
 /// Simulation study types.
 enum StudyTypes
 {
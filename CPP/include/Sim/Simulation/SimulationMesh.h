@@ -0,0 +1,408 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "../../Core/Base.h"
+#include "../SimTypeDefs.h"
+#include <string>
+#include <vector>
+
+// THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
+// THIS HEADER FILE WILL BE GENERATED FROM NIDL.
+#include "../../Core/OSMacros.h"
+
+#ifdef SIMXINTERFACE_EXPORTS
+# ifdef __COMPILING_ADSK_SIM_SIMULATIONMESH_CPP__
+# define ADSK_SIM_SIMULATIONMESH_API XI_EXPORT
+# else
+# define ADSK_SIM_SIMULATIONMESH_API
+# endif
+#else
+# define ADSK_SIM_SIMULATIONMESH_API XI_IMPORT
+#endif
+
+namespace adsk { namespace fusion {
+    class BRepBody;
+}}
+namespace adsk { namespace sim {
+    class SimAttribute;
+}}
+
+namespace adsk { namespace sim {
+
+/// !!!!! Warning !!!!!
+/// ! This is hidden and not officially supported
+/// !!!!! Warning !!!!!
+/// 
+/// A mesh of the model components of a simulation model, created by SimulationModel.createMesh, as flat arrays ready
+/// to be passed to a solver. The loads and constraints of the load case of the input are mapped to sets: each set has
+/// the nodes and the element faces the load or constraint is applied to.
+/// Node and element indices start at 0. Coordinates are in centimeters.
+/// The nodes of an element are ordered as follows:
+/// - LinearTriangleMeshElementType: nodes 0, 1, 2 are the corners, counterclockwise when seen from outside the body.
+/// - LinearTetrahedronMeshElementType: nodes 0, 1, 2, 3 are the corners, ordered so that node 3 is on the side the
+/// cross product of (node 1 - node 0) and (node 2 - node 0) points to, which gives the element a positive volume.
+/// - QuadraticTetrahedronMeshElementType: nodes 0 to 3 are the corners as for linear tetrahedra, and nodes 4 to 9 are the
+/// midsides of the edges 0-1, 1-2, 2-0, 0-3, 1-3 and 2-3 in this order.
+/// The faces of a tetrahedron are numbered so that face i is opposite node i. With outward normals, face 0 has the
+/// corners 1, 2, 3, face 1 has the corners 0, 3, 2, face 2 has the corners 0, 1, 3 and face 3 has the corners 0, 2, 1.
+/// A triangle element has the single face 0, the triangle itself.
+class SimulationMesh : public core::Base {
+public:
+
+    /// The type of the elements of the mesh.
+    MeshElementTypes elementType() const;
+
+    /// The number of nodes of each element.
+    int nodesPerElement() const;
+
+    /// The number of nodes of the mesh.
+    int nodeCount() const;
+
+    /// The number of elements of the mesh.
+    int elementCount() const;
+
+    /// Returns the coordinates of the nodes as an array of doubles where they are the x, y, z components of each node.
+    /// startIndex : The index of the first node to return.
+    /// count : The number of nodes to return. Use -1 to return all nodes from startIndex to the end.
+    /// Returns an array of 3 * count values.
+    std::vector<double> nodeCoordinates(int startIndex = 0, int count = -1) const;
+
+    /// Returns the indices of the nodes of each element, in the node order described for the element type in the class description.
+    /// startIndex : The index of the first element to return.
+    /// count : The number of elements to return. Use -1 to return all elements from startIndex to the end.
+    /// Returns an array of nodesPerElement * count values.
+    std::vector<int> elementNodeIndices(int startIndex = 0, int count = -1) const;
+
+    /// Returns the index into bodies of the body of each element.
+    /// startIndex : The index of the first element to return.
+    /// count : The number of elements to return. Use -1 to return all elements from startIndex to the end.
+    /// Returns an array of count values.
+    std::vector<int> elementBodyIndices(int startIndex = 0, int count = -1) const;
+
+    /// The bodies that were meshed.
+    std::vector<core::Ptr<fusion::BRepBody>> bodies() const;
+
+    /// The load or constraint of each set, in the order of the load case.
+    std::vector<core::Ptr<SimAttribute>> setItems() const;
+
+    /// The kind of each set. The values are obtained from the MeshSetTypes enum and returned as integers. The array has one entry for each set.
+    std::vector<int> setTypes() const;
+
+    /// The constraint type of each set. The values are obtained from the ConstraintTypes enum and returned as integers.
+    /// The entry is UnknownConstraintType for load sets. The array has one entry for each set.
+    std::vector<int> setConstraintTypes() const;
+
+    /// The name of the load or constraint of each set as displayed in the browser. The array has one entry for each set.
+    std::vector<std::string> setNames() const;
+
+    /// The index in setNodeIndices of the first node of each set. The array has one entry for each set.
+    std::vector<int> setNodeStartIndices() const;
+
+    /// The nodes of all sets, one set after another.
+    std::vector<int> setNodeIndices() const;
+
+    /// The index in setFaceElementIndices of the first element face of each set. The array has one entry for each set.
+    std::vector<int> setFaceStartIndices() const;
+
+    /// The element of each element face of all sets, one set after another.
+    std::vector<int> setFaceElementIndices() const;
+
+    /// The index of each element face of all sets within its element, as numbered in the class description.
+    /// The array has the same size as setFaceElementIndices.
+    std::vector<int> setFaceLocalIndices() const;
+
+    /// Writes the mesh to a compact binary file that can be memory mapped. All values are little endian, and "padding" means
+    /// zero bytes up to the next offset that is a multiple of 8, so that every array starts 8 byte aligned. The layout is:
+    /// - char[8] signature "ADSKMSH1".
+    /// - uint64 element type (MeshElementTypes), uint64 nodesPerElement, uint64 nodeCount, uint64 elementCount, uint64 set count.
+    /// - float64[3 * nodeCount] node coordinates.
+    /// - int32[nodesPerElement * elementCount] element node indices, then padding.
+    /// - int32[elementCount] element body indices, then padding.
+    /// - For each set, in the order of setItems: uint32 set type (MeshSetTypes), uint32 constraint type (ConstraintTypes),
+    /// uint64 node count, uint64 face count, uint64 name length in bytes, the UTF-8 name without terminator, then padding,
+    /// int32[node count] node indices, then padding, int32[face count] face element indices, then padding,
+    /// and int32[face count] face local indices, then padding.
+    /// filePath : The full path of the file to write.
+    /// Returns true if the file was written.
+    bool saveToFile(const std::string& filePath) const;
+
+    /// The time in seconds spent creating the mesh.
+    double duration() const;
+
+    /// The largest amount of memory in bytes used while creating the mesh.
+    size_t peakMemoryUsage() const;
+
+    ADSK_SIM_SIMULATIONMESH_API static const char* classType();
+    ADSK_SIM_SIMULATIONMESH_API const char* objectType() const override;
+    ADSK_SIM_SIMULATIONMESH_API void* queryInterface(const char* id) const override;
+    ADSK_SIM_SIMULATIONMESH_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual MeshElementTypes elementType_raw() const = 0;
+    virtual int nodesPerElement_raw() const = 0;
+    virtual int nodeCount_raw() const = 0;
+    virtual int elementCount_raw() const = 0;
+    virtual double* nodeCoordinates_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual int* elementNodeIndices_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual int* elementBodyIndices_raw(int startIndex, int count, size_t& return_size) const = 0;
+    virtual fusion::BRepBody** bodies_raw(size_t& return_size) const = 0;
+    virtual SimAttribute** setItems_raw(size_t& return_size) const = 0;
+    virtual int* setTypes_raw(size_t& return_size) const = 0;
+    virtual int* setConstraintTypes_raw(size_t& return_size) const = 0;
+    virtual char** setNames_raw(size_t& return_size) const = 0;
+    virtual int* setNodeStartIndices_raw(size_t& return_size) const = 0;
+    virtual int* setNodeIndices_raw(size_t& return_size) const = 0;
+    virtual int* setFaceStartIndices_raw(size_t& return_size) const = 0;
+    virtual int* setFaceElementIndices_raw(size_t& return_size) const = 0;
+    virtual int* setFaceLocalIndices_raw(size_t& return_size) const = 0;
+    virtual bool saveToFile_raw(const char* filePath) const = 0;
+    virtual double duration_raw() const = 0;
+    virtual size_t peakMemoryUsage_raw() const = 0;
+};
+
+// Inline wrappers
+
+inline MeshElementTypes SimulationMesh::elementType() const
+{
+    MeshElementTypes res = elementType_raw();
+    return res;
+}
+
+inline int SimulationMesh::nodesPerElement() const
+{
+    int res = nodesPerElement_raw();
+    return res;
+}
+
+inline int SimulationMesh::nodeCount() const
+{
+    int res = nodeCount_raw();
+    return res;
+}
+
+inline int SimulationMesh::elementCount() const
+{
+    int res = elementCount_raw();
+    return res;
+}
+
+inline std::vector<double> SimulationMesh::nodeCoordinates(int startIndex, int count) const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= nodeCoordinates_raw(startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<int> SimulationMesh::elementNodeIndices(int startIndex, int count) const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= elementNodeIndices_raw(startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<int> SimulationMesh::elementBodyIndices(int startIndex, int count) const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= elementBodyIndices_raw(startIndex, count, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<core::Ptr<fusion::BRepBody>> SimulationMesh::bodies() const
+{
+    std::vector<core::Ptr<fusion::BRepBody>> res;
+    size_t s;
+
+    fusion::BRepBody** p= bodies_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<core::Ptr<SimAttribute>> SimulationMesh::setItems() const
+{
+    std::vector<core::Ptr<SimAttribute>> res;
+    size_t s;
+
+    SimAttribute** p= setItems_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<int> SimulationMesh::setTypes() const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= setTypes_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<int> SimulationMesh::setConstraintTypes() const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= setConstraintTypes_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<std::string> SimulationMesh::setNames() const
+{
+    std::vector<std::string> res;
+    size_t s;
+
+    char** p= setNames_raw(s);
+    if(p)
+    {
+        res.resize(s);
+        for(size_t i=0; i<s; ++i)
+        {
+            char* pChar = p[i];
+            if(pChar)
+                res[i] = pChar;
+            core::DeallocateArray(pChar);
+        }
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<int> SimulationMesh::setNodeStartIndices() const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= setNodeStartIndices_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<int> SimulationMesh::setNodeIndices() const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= setNodeIndices_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<int> SimulationMesh::setFaceStartIndices() const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= setFaceStartIndices_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<int> SimulationMesh::setFaceElementIndices() const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= setFaceElementIndices_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<int> SimulationMesh::setFaceLocalIndices() const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= setFaceLocalIndices_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        core::DeallocateArray(p);
+    }
+    return res;
+}
+
+inline bool SimulationMesh::saveToFile(const std::string& filePath) const
+{
+    bool res = saveToFile_raw(filePath.c_str());
+    return res;
+}
+
+inline double SimulationMesh::duration() const
+{
+    double res = duration_raw();
+    return res;
+}
+
+inline size_t SimulationMesh::peakMemoryUsage() const
+{
+    size_t res = peakMemoryUsage_raw();
+    return res;
+}
+}// namespace sim
+}// namespace adsk
+
+#undef ADSK_SIM_SIMULATIONMESH_API
\ No newline at end of file
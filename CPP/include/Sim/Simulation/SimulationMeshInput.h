@@ -0,0 +1,127 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "../../Core/Base.h"
+#include "../SimTypeDefs.h"
+
+// THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
+// THIS HEADER FILE WILL BE GENERATED FROM NIDL.
+#include "../../Core/OSMacros.h"
+
+#ifdef SIMXINTERFACE_EXPORTS
+# ifdef __COMPILING_ADSK_SIM_SIMULATIONMESHINPUT_CPP__
+# define ADSK_SIM_SIMULATIONMESHINPUT_API XI_EXPORT
+# else
+# define ADSK_SIM_SIMULATIONMESHINPUT_API
+# endif
+#else
+# define ADSK_SIM_SIMULATIONMESHINPUT_API XI_IMPORT
+#endif
+
+namespace adsk { namespace sim {
+    class LoadCase;
+}}
+
+namespace adsk { namespace sim {
+
+/// !!!!! Warning !!!!!
+/// ! This is hidden and not officially supported
+/// !!!!! Warning !!!!!
+/// 
+/// Object that defines the settings used by SimulationModel.createMesh to mesh the model components for an external solver.
+/// Use the SimulationModel.createMeshInput method to create a new input object.
+class SimulationMeshInput : public core::Base {
+public:
+
+    /// The type of the elements of the mesh. Defaults to QuadraticTetrahedronMeshElementType.
+    MeshElementTypes elementType() const;
+    bool elementType(MeshElementTypes value);
+
+    /// The target edge length of the elements in centimeters. 0 uses a size derived from the bounding box of the model. Defaults to 0.
+    double elementSize() const;
+    bool elementSize(double value);
+
+    /// The load case whose loads and constraints are mapped to node and face sets of the mesh.
+    /// If null, the mesh has no sets. Defaults to null.
+    core::Ptr<LoadCase> loadCase() const;
+    bool loadCase(const core::Ptr<LoadCase>& value);
+
+    /// The maximum number of bodies meshed at the same time. 0 uses the number of processor cores. Defaults to 0.
+    int maxConcurrency() const;
+    bool maxConcurrency(int value);
+
+    ADSK_SIM_SIMULATIONMESHINPUT_API static const char* classType();
+    ADSK_SIM_SIMULATIONMESHINPUT_API const char* objectType() const override;
+    ADSK_SIM_SIMULATIONMESHINPUT_API void* queryInterface(const char* id) const override;
+    ADSK_SIM_SIMULATIONMESHINPUT_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual MeshElementTypes elementType_raw() const = 0;
+    virtual bool elementType_raw(MeshElementTypes value) = 0;
+    virtual double elementSize_raw() const = 0;
+    virtual bool elementSize_raw(double value) = 0;
+    virtual LoadCase* loadCase_raw() const = 0;
+    virtual bool loadCase_raw(LoadCase* value) = 0;
+    virtual int maxConcurrency_raw() const = 0;
+    virtual bool maxConcurrency_raw(int value) = 0;
+};
+
+// Inline wrappers
+
+inline MeshElementTypes SimulationMeshInput::elementType() const
+{
+    MeshElementTypes res = elementType_raw();
+    return res;
+}
+
+inline bool SimulationMeshInput::elementType(MeshElementTypes value)
+{
+    return elementType_raw(value);
+}
+
+inline double SimulationMeshInput::elementSize() const
+{
+    double res = elementSize_raw();
+    return res;
+}
+
+inline bool SimulationMeshInput::elementSize(double value)
+{
+    return elementSize_raw(value);
+}
+
+inline core::Ptr<LoadCase> SimulationMeshInput::loadCase() const
+{
+    core::Ptr<LoadCase> res = loadCase_raw();
+    return res;
+}
+
+inline bool SimulationMeshInput::loadCase(const core::Ptr<LoadCase>& value)
+{
+    return loadCase_raw(value.get());
+}
+
+inline int SimulationMeshInput::maxConcurrency() const
+{
+    int res = maxConcurrency_raw();
+    return res;
+}
+
+inline bool SimulationMeshInput::maxConcurrency(int value)
+{
+    return maxConcurrency_raw(value);
+}
+}// namespace sim
+}// namespace adsk
+
+#undef ADSK_SIM_SIMULATIONMESHINPUT_API
\ No newline at end of file
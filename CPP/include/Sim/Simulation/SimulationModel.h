@@ -31,6 +31,8 @@ namespace adsk { namespace fusion {
     class WorkingModel;
 }}
 namespace adsk { namespace sim {
+    class SimulationMesh;
+    class SimulationMeshInput;
     class Simulations;
     class Studies;
 }}
@@ -58,6 +60,15 @@ public:
     /// The ModelComponents that provides access to Bodies/Components in the model.
     core::Ptr<fusion::WorkingModel> modelComponents() const;
 
+    /// Creates a new SimulationMeshInput object with the default mesh settings to be used with the createMesh method.
+    /// Returns the newly created input object.
+    core::Ptr<SimulationMeshInput> createMeshInput();
+
+    /// Meshes the bodies of the model components for an external solver. Bodies are meshed in parallel.
+    /// input : The SimulationMeshInput object that defines the element type, the element size and the load case.
+    /// Returns the mesh or null if meshing failed.
+    core::Ptr<SimulationMesh> createMesh(const core::Ptr<SimulationMeshInput>& input);
+
     ADSK_SIM_SIMULATIONMODEL_API static const char* classType();
     ADSK_SIM_SIMULATIONMODEL_API const char* objectType() const override;
     ADSK_SIM_SIMULATIONMODEL_API void* queryInterface(const char* id) const override;
@@ -71,6 +82,8 @@ private:
     virtual Simulations* parentSimulations_raw() const = 0;
     virtual Studies* studies_raw() const = 0;
     virtual fusion::WorkingModel* modelComponents_raw() const = 0;
+    virtual SimulationMeshInput* createMeshInput_raw() = 0;
+    virtual SimulationMesh* createMesh_raw(SimulationMeshInput* input) = 0;
 };
 
 // Inline wrappers
@@ -110,6 +123,18 @@ inline core::Ptr<fusion::WorkingModel> SimulationModel::modelComponents() const
     core::Ptr<fusion::WorkingModel> res = modelComponents_raw();
     return res;
 }
+
+inline core::Ptr<SimulationMeshInput> SimulationModel::createMeshInput()
+{
+    core::Ptr<SimulationMeshInput> res = createMeshInput_raw();
+    return res;
+}
+
+inline core::Ptr<SimulationMesh> SimulationModel::createMesh(const core::Ptr<SimulationMeshInput>& input)
+{
+    core::Ptr<SimulationMesh> res = createMesh_raw(input.get());
+    return res;
+}
 }// namespace sim
 }// namespace adsk
 
@@ -69,6 +69,37 @@ class CAMAdditiveContainerTypes():
     BodyPresetCAMAdditiveContainerType = 2
     AdditiveProcessSimulationCAMAdditiveContainerType = 3
 
+class CAMLibraryIndexEntryTypes():
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    The types of library entries stored in a CAMLibraryIndex.
+    """
+    def __init__(self):
+        pass
+    MachineCAMLibraryIndexEntryType = 0
+    PostConfigurationCAMLibraryIndexEntryType = 1
+    PrintSettingCAMLibraryIndexEntryType = 2
+
+class CAMParameterValueTypes():
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    The types of the values of CAM parameters as reported by a CAMParametersSnapshot.
+    """
+    def __init__(self):
+        pass
+    FloatCAMParameterValueType = 0
+    IntegerCAMParameterValueType = 1
+    BooleanCAMParameterValueType = 2
+    StringCAMParameterValueType = 3
+    ChoiceCAMParameterValueType = 4
+    OtherCAMParameterValueType = 5
+
 class DefaultGroupType():
     """
     Types of default groups. Used to specify which default group to be retrieved by defaultGroup method.
@@ -138,6 +169,7 @@ class GeneratedDataType():
     def __init__(self):
         pass
     OptimizedOrientationGeneratedDataType = 0
+    ToolpathGeneratedDataType = 1
 
 class HoleSegmentType():
     """
@@ -260,6 +292,21 @@ class MachineItemType():
     MachineItemType_TURRET_INACTIVE_TOOL = 8
     MachineItemType_INVALID = 9
 
+class MachineKinematicsIssueTypes():
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    The types of issues reported by a MachineKinematicsSolver.
+    """
+    def __init__(self):
+        pass
+    UnreachableMachineKinematicsIssueType = 0
+    AxisLimitMachineKinematicsIssueType = 1
+    SingularityMachineKinematicsIssueType = 2
+    RotaryUnwindMachineKinematicsIssueType = 3
+
 class MachineNonTCPInterpolationMode():
     """
     !!!!! Warning !!!!!
@@ -334,6 +381,23 @@ class MachiningMode():
     Gouge_MachiningMode = 2
     Fixture_MachiningMode = 3
 
+class MachiningTimeLimitingFactors():
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    The factors limiting the speed of a move in a kinematic machining time estimate.
+    """
+    def __init__(self):
+        pass
+    ProgrammedFeedrateLimitingFactor = 0
+    AxisSpeedLimitingFactor = 1
+    AxisAccelerationLimitingFactor = 2
+    AxisJerkLimitingFactor = 3
+    BlockProcessingLimitingFactor = 4
+    LookAheadLimitingFactor = 5
+
 class ModifyUtilityTypes():
     """
     Types of provided ModifyUtility.
@@ -560,6 +624,87 @@ class SplitSupportTypes():
     SolidOpenMergedSplitSupportType = 0
     SolidOpenSeparateSplitSupportType = 1
 
+class StockSimulationCollisionTypes():
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    The types of collisions detected by a stock simulation.
+    """
+    def __init__(self):
+        pass
+    RapidStockSimulationCollisionType = 0
+    ShankStockSimulationCollisionType = 1
+    HolderStockSimulationCollisionType = 2
+    FixtureStockSimulationCollisionType = 3
+    GougeStockSimulationCollisionType = 4
+
+class ToolIndexFields():
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    The numeric fields of the tools stored in a ToolIndex.
+    """
+    def __init__(self):
+        pass
+    DiameterToolIndexField = 0
+    FluteLengthToolIndexField = 1
+    CornerRadiusToolIndexField = 2
+    OverallLengthToolIndexField = 3
+    ShaftDiameterToolIndexField = 4
+    NumberOfFlutesToolIndexField = 5
+
+class ToolpathInvalidationReasons():
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    The reasons why the toolpath of an operation needs to be regenerated.
+    """
+    def __init__(self):
+        pass
+    GeometrySelectionChangedInvalidationReason = 0
+    ModelChangedInvalidationReason = 1
+    StockChangedInvalidationReason = 2
+    MissingReferenceInvalidationReason = 3
+    DependencyInvalidationReason = 4
+    ParameterChangedInvalidationReason = 5
+
+class ToolpathMoveTypes():
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    The types of moves in the toolpath of an operation.
+    """
+    def __init__(self):
+        pass
+    RapidToolpathMoveType = 0
+    LeadInToolpathMoveType = 1
+    LeadOutToolpathMoveType = 2
+    CuttingToolpathMoveType = 3
+    LinkingToolpathMoveType = 4
+    PlungeToolpathMoveType = 5
+
+class ToolpathSegmentTypes():
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    The types of segments in the toolpath of an operation.
+    """
+    def __init__(self):
+        pass
+    LinearToolpathSegmentType = 0
+    CircularToolpathSegmentType = 1
+    HelicalToolpathSegmentType = 2
+
 class ArrangeSelections(core.Base):
     """
     Collection for all arrange selections to be passed to a CAMArrangeParameterValue object.
@@ -757,6 +902,27 @@ class CAMAdditiveBuildExportFilter(core.Base):
         """
         return str()
 
+class CAMBatchedChangeEventHandler(core.EventHandler):
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    The CAMBatchedChangeEventHandler is a client implemented class that can be added as a handler to a
+    CAMBatchedChangeEvent.
+    """
+    def __init__(self):
+        pass
+    @staticmethod
+    def cast(arg) -> CAMBatchedChangeEventHandler:
+        return CAMBatchedChangeEventHandler()
+    def notify(self, eventArgs: CAMBatchedChangeEventArgs) -> None:
+        """
+        The function called by CAM when the associated event is fired.
+        eventArgs : Returns an object that provides access to additional information associated with the event.
+        """
+        pass
+
 class CAMExportFuture(core.Base):
     """
      Used to check the state and get back the results of an operation generation.
@@ -782,6 +948,7 @@ class CAMExportFuture(core.Base):
     def progress(self) -> float:
         """
         Returns the progress as a percentage value between 0.0% and 100.0%.
+        For 3MF exports with CAM3MFExportOptions.isStreamed set, the progress reflects the bytes written to the file.
         """
         return float()
     @property
@@ -798,6 +965,37 @@ class CAMExportFuture(core.Base):
         Returns an empty string if no warnings have been found.
         """
         return str()
+    @property
+    def bytesWritten(self) -> int:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Returns the number of bytes written to the export file so far.
+        """
+        return int()
+    @property
+    def estimatedSize(self) -> int:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Returns the estimated size of the export file in bytes, or 0 if the size cannot be estimated.
+        For streamed 3MF exports, progress is bytesWritten relative to this estimate.
+        """
+        return int()
+    @property
+    def peakMemoryUsage(self) -> int:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Returns the largest amount of memory in bytes used to buffer the export so far.
+        """
+        return int()
 
 class CAMExportManager(core.Base):
     """
@@ -1029,6 +1227,180 @@ class CAMLibrary(core.Base):
         """
         return str()
 
+class CAMLibraryIndex(core.Base):
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    An index of the machines, post configurations and print settings of library folders, stored in a file on disk.
+    The index keeps the keys used by the library queries and the modification time of each file, so that queries can be
+    answered without reading the library folders again. Set it as the libraryIndex of the CAMLibraryManager to make
+    MachineQuery, PostConfigurationQuery, PrintSettingQuery and PostLibrary.childPostConfigurations use it.
+    Use the CAMLibraryManager.openLibraryIndex method to open or create an index.
+    """
+    def __init__(self):
+        pass
+    @staticmethod
+    def cast(arg) -> CAMLibraryIndex:
+        return CAMLibraryIndex()
+    @property
+    def filePath(self) -> str:
+        """
+        Returns the full path of the file the index is stored in.
+        """
+        return str()
+    def addLibraries(self, entryType: CAMLibraryIndexEntryTypes, location: LibraryLocations) -> bool:
+        """
+        Adds the folders of a library location to the index. Folders added to the location later are picked up by update.
+        entryType : The type of the entries of the library.
+        location : The location of the library to add.
+        Returns true if the location was added successfully.
+        """
+        return bool()
+    def addFolder(self, entryType: CAMLibraryIndexEntryTypes, url: core.URL) -> bool:
+        """
+        Adds a single library folder and its subfolders to the index, for instance the network machine folder.
+        entryType : The type of the entries of the folder.
+        url : The URL of the folder to add.
+        Returns true if the folder was added successfully.
+        """
+        return bool()
+    @property
+    def folderURLs(self) -> list[core.URL]:
+        """
+        Returns the URLs of the folders in the index.
+        """
+        return [core.URL()]
+    @property
+    def maxConcurrency(self) -> int:
+        """
+        Gets and sets the maximum number of folders scanned at the same time by update.
+        0 uses the number of processor cores. Defaults to 0.
+        """
+        return int()
+    @maxConcurrency.setter
+    def maxConcurrency(self, value: int):
+        """
+        Gets and sets the maximum number of folders scanned at the same time by update.
+        0 uses the number of processor cores. Defaults to 0.
+        """
+        pass
+    def update(self) -> int:
+        """
+        Scans the folders of the index in parallel and saves the index to its file. Only files that were added, or whose
+        modification time or size changed since the last update, are read. Files that no longer exist are removed from the index.
+        Returns the number of files that were read, or -1 if the update failed.
+        """
+        return int()
+    def invalidate(self, url: core.URL) -> bool:
+        """
+        Removes the entries of a folder from the index so they are read again by the next update.
+        url : The URL of the folder to invalidate.
+        Returns true if the folder was part of the index.
+        """
+        return bool()
+    @property
+    def lastUpdateDuration(self) -> float:
+        """
+        Returns the time in seconds spent by the last update.
+        """
+        return float()
+    @property
+    def entryCount(self) -> int:
+        """
+        Returns the number of entries in the index.
+        """
+        return int()
+    def entryTypes(self, startIndex: int = 0, count: int = -1) -> list[int]:
+        """
+        Returns the type of each entry. The values are obtained from the CAMLibraryIndexEntryTypes enum and returned as integers.
+        startIndex : The index of the first entry to return.
+        count : The number of entries to return. Use -1 to return all entries from startIndex to the end of the index.
+        Returns an array of count values.
+        """
+        return [int()]
+    def filePaths(self, startIndex: int = 0, count: int = -1) -> list[str]:
+        """
+        Returns the full path of the file of each entry.
+        startIndex : The index of the first entry to return.
+        count : The number of entries to return. Use -1 to return all entries from startIndex to the end of the index.
+        Returns an array of count values.
+        """
+        return [str()]
+    def modificationTimes(self, startIndex: int = 0, count: int = -1) -> list[float]:
+        """
+        Returns the modification time of the file of each entry when it was last read, in seconds since 1970-01-01 UTC.
+        startIndex : The index of the first entry to return.
+        count : The number of entries to return. Use -1 to return all entries from startIndex to the end of the index.
+        Returns an array of count values.
+        """
+        return [float()]
+    def descriptions(self, startIndex: int = 0, count: int = -1) -> list[str]:
+        """
+        Returns the description of each entry.
+        startIndex : The index of the first entry to return.
+        count : The number of entries to return. Use -1 to return all entries from startIndex to the end of the index.
+        Returns an array of count values.
+        """
+        return [str()]
+    def vendors(self, startIndex: int = 0, count: int = -1) -> list[str]:
+        """
+        Returns the vendor of each entry, or an empty string if the entry has no vendor.
+        startIndex : The index of the first entry to return.
+        count : The number of entries to return. Use -1 to return all entries from startIndex to the end of the index.
+        Returns an array of count values.
+        """
+        return [str()]
+    def models(self, startIndex: int = 0, count: int = -1) -> list[str]:
+        """
+        Returns the model of each machine entry, or an empty string for other entries.
+        startIndex : The index of the first entry to return.
+        count : The number of entries to return. Use -1 to return all entries from startIndex to the end of the index.
+        Returns an array of count values.
+        """
+        return [str()]
+    def technologies(self, startIndex: int = 0, count: int = -1) -> list[str]:
+        """
+        Returns the technology of each print setting entry, or an empty string for other entries.
+        startIndex : The index of the first entry to return.
+        count : The number of entries to return. Use -1 to return all entries from startIndex to the end of the index.
+        Returns an array of count values.
+        """
+        return [str()]
+    def capabilities(self, startIndex: int = 0, count: int = -1) -> list[int]:
+        """
+        Returns the capabilities of each post configuration entry as a combination of PostCapabilities values, or 0 for other entries.
+        startIndex : The index of the first entry to return.
+        count : The number of entries to return. Use -1 to return all entries from startIndex to the end of the index.
+        Returns an array of count values.
+        """
+        return [int()]
+    def materials(self, startIndex: int = 0, count: int = -1) -> list[str]:
+        """
+        Returns the material of each print setting entry, or an empty string for other entries.
+        startIndex : The index of the first entry to return.
+        count : The number of entries to return. Use -1 to return all entries from startIndex to the end of the index.
+        Returns an array of count values.
+        """
+        return [str()]
+    def filamentDiameters(self, startIndex: int = 0, count: int = -1) -> list[float]:
+        """
+        Returns the filament diameter in cm of each FFF print setting entry, or 0 for other entries.
+        startIndex : The index of the first entry to return.
+        count : The number of entries to return. Use -1 to return all entries from startIndex to the end of the index.
+        Returns an array of count values.
+        """
+        return [float()]
+    def layerHeights(self, startIndex: int = 0, count: int = -1) -> list[float]:
+        """
+        Returns the layer height in cm of each print setting entry, or 0 for other entries.
+        startIndex : The index of the first entry to return.
+        count : The number of entries to return. Use -1 to return all entries from startIndex to the end of the index.
+        Returns an array of count values.
+        """
+        return [float()]
+
 class CAMLibraryManager(core.Base):
     """
     CAMLibraryManager provides access to properties related to various libraries in the
@@ -1087,6 +1459,48 @@ class CAMLibraryManager(core.Base):
         You can only get a valid StockMaterialLibrary when you have access to Stock Materials private preview feature and enable the feature flag.
         """
         return StockMaterialLibrary()
+    def openLibraryIndex(self, filePath: str) -> CAMLibraryIndex:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Opens the library index stored in the specified file, or creates a new empty index if the file does not exist.
+        Call CAMLibraryIndex.update to bring the index up to date with its folders.
+        filePath : The full path of the index file. If empty, the default index file in the user's cache folder is used.
+        Returns the library index or null if the file could not be opened.
+        """
+        return CAMLibraryIndex()
+    @property
+    def libraryIndex(self) -> CAMLibraryIndex:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Gets and sets the library index used to answer machine, post configuration and print setting queries.
+        Queries on folders of the index are answered from the index in memory and only the matching files are loaded.
+        The vendor, model, technology, capabilities, material, filament diameter and layer height of the queries are matched
+        against the index. The machine of a PrintSettingQuery is not indexed: the print settings matching the other fields are
+        loaded to check their compatibility with the machine.
+        Queries on other folders scan the folders as before. Null by default.
+        """
+        return CAMLibraryIndex()
+    @libraryIndex.setter
+    def libraryIndex(self, value: CAMLibraryIndex):
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Gets and sets the library index used to answer machine, post configuration and print setting queries.
+        Queries on folders of the index are answered from the index in memory and only the matching files are loaded.
+        The vendor, model, technology, capabilities, material, filament diameter and layer height of the queries are matched
+        against the index. The machine of a PrintSettingQuery is not indexed: the print settings matching the other fields are
+        loaded to check their compatibility with the machine.
+        Queries on other folders scan the folders as before. Null by default.
+        """
+        pass
 
 class CAMManager(core.Base):
     """
@@ -1300,37 +1714,211 @@ class CAMParameters(core.Base):
         The number of items in the collection.
         """
         return int()
+    def snapshot(self) -> CAMParametersSnapshot:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Takes a snapshot of all parameters in the collection in a single call, instead of querying each parameter individually.
+        Returns the snapshot or null if it could not be taken.
+        """
+        return CAMParametersSnapshot()
+    def setExpressions(self, names: list[str], expressions: list[str]) -> tuple[bool, list[str]]:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Sets the expressions of several parameters at once. All expressions are applied first and then validated
+        together, and the parent is invalidated only once. If any expression is invalid, none of the parameters is changed.
+        names : The ids (internal names) of the parameters to set.
+        expressions : The new expressions. The array must have the same size as names.
+        failedNames : Output array with the ids of the parameters that do not exist, are not editable or whose expression is invalid.
+        Returns true if all expressions were set successfully.
+        """
+        return (bool(), [str()])
 
-class CAMPatterns(core.Base):
+class CAMParametersDifference(core.Base):
     """
-    Collection that provides access to the patterns within an existing setup, folder or pattern.
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    The differences between two CAMParametersSnapshot objects, as returned by CAMParametersSnapshot.compare.
+    Parameters are matched by their id (internal name) and are considered changed if their expressions differ.
     """
     def __init__(self):
         pass
     @staticmethod
-    def cast(arg) -> CAMPatterns:
-        return CAMPatterns()
-    def __len__(self) -> int:
-        return 0
-    def __getitem__(self, index: int) -> CAMPattern:
-        return None
-    def __iter__(self) -> Iterator[CAMPattern]:
-        return None
-    def item(self, index: int) -> CAMPattern:
+    def cast(arg) -> CAMParametersDifference:
+        return CAMParametersDifference()
+    @property
+    def isEqual(self) -> bool:
         """
-        Function that returns the specified pattern using an index into the collection.
-        index : The index of the item within the collection to return.  The first item in the collection has an index of 0.
-        Returns the specified item or null if an invalid index was specified.
+        Returns true if both snapshots have the same parameters with the same expressions.
         """
-        return CAMPattern()
-    def itemByName(self, name: str) -> CAMPattern:
+        return bool()
+    @property
+    def addedNames(self) -> list[str]:
         """
-        Returns the pattern with the specified name (as appears in the browser).
-        name : The name (as it appears in the browser) of the pattern.
-        Returns the specified pattern or null in the case where there is no pattern with the specified name.
+        Returns the ids of the parameters that only exist in the other snapshot.
         """
-        return CAMPattern()
-    def itemByOperationId(self, id: int) -> CAMPattern:
+        return [str()]
+    @property
+    def removedNames(self) -> list[str]:
+        """
+        Returns the ids of the parameters that only exist in this snapshot.
+        """
+        return [str()]
+    @property
+    def changedNames(self) -> list[str]:
+        """
+        Returns the ids of the parameters whose expression differs.
+        """
+        return [str()]
+    @property
+    def oldExpressions(self) -> list[str]:
+        """
+        Returns the expressions of the changed parameters in this snapshot. The array has the same size and order as changedNames.
+        """
+        return [str()]
+    @property
+    def newExpressions(self) -> list[str]:
+        """
+        Returns the expressions of the changed parameters in the other snapshot. The array has the same size and order as changedNames.
+        """
+        return [str()]
+
+class CAMParametersSnapshot(core.Base):
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    A read-only copy of all parameters of an operation or a tool, taken with a single call of CAMParameters.snapshot.
+    Instead of one object per parameter, the ids, expressions, values and flags of all parameters are available as
+    parallel arrays. The snapshot is not updated when the parameters change afterwards.
+    """
+    def __init__(self):
+        pass
+    @staticmethod
+    def cast(arg) -> CAMParametersSnapshot:
+        return CAMParametersSnapshot()
+    @property
+    def parent(self) -> core.Base:
+        """
+        Returns the object the parameters belong to, like an operation or a tool.
+        """
+        return core.Base()
+    @property
+    def count(self) -> int:
+        """
+        Returns the number of parameters in the snapshot.
+        """
+        return int()
+    @property
+    def names(self) -> list[str]:
+        """
+        Returns the id (internal name) of each parameter.
+        """
+        return [str()]
+    @property
+    def expressions(self) -> list[str]:
+        """
+        Returns the expression of each parameter. The array has one entry for each parameter, in the same order as names.
+        """
+        return [str()]
+    @property
+    def valueTypes(self) -> list[int]:
+        """
+        Returns the type of the value of each parameter. The values are obtained from the CAMParameterValueTypes enum
+        and returned as integers. The array has one entry for each parameter, in the same order as names.
+        """
+        return [int()]
+    @property
+    def numericValues(self) -> list[float]:
+        """
+        Returns the value of each float, integer and boolean parameter. Float values are in internal units, boolean values
+        are 1 for true and 0 for false. The entry is 0 for parameters of other types. The array has one entry for each parameter, in the same order as names.
+        """
+        return [float()]
+    @property
+    def stringValues(self) -> list[str]:
+        """
+        Returns the value of each string parameter and the selected choice of each choice parameter.
+        The entry is empty for parameters of other types. The array has one entry for each parameter, in the same order as names.
+        """
+        return [str()]
+    @property
+    def isEnabled(self) -> list[bool]:
+        """
+        Returns whether each parameter is enabled. The array has one entry for each parameter, in the same order as names.
+        """
+        return [bool()]
+    @property
+    def isEditable(self) -> list[bool]:
+        """
+        Returns whether each parameter is editable. The array has one entry for each parameter, in the same order as names.
+        """
+        return [bool()]
+    @property
+    def isVisible(self) -> list[bool]:
+        """
+        Returns whether each parameter is visible in the user interface. The array has one entry for each parameter, in the same order as names.
+        """
+        return [bool()]
+    @property
+    def hasError(self) -> list[bool]:
+        """
+        Returns whether each parameter has an error. The array has one entry for each parameter, in the same order as names.
+        """
+        return [bool()]
+    def indexByName(self, internalName: str) -> int:
+        """
+        Returns the index of a parameter in the arrays of the snapshot.
+        internalName : The id (internal name) of the parameter.
+        Returns the index of the parameter or -1 if the snapshot has no parameter with the specified id.
+        """
+        return int()
+    def compare(self, other: CAMParametersSnapshot) -> CAMParametersDifference:
+        """
+        Compares this snapshot with another snapshot, for instance of the same operation at a later time or of another operation.
+        other : The snapshot to compare with.
+        Returns the differences between the two snapshots.
+        """
+        return CAMParametersDifference()
+
+class CAMPatterns(core.Base):
+    """
+    Collection that provides access to the patterns within an existing setup, folder or pattern.
+    """
+    def __init__(self):
+        pass
+    @staticmethod
+    def cast(arg) -> CAMPatterns:
+        return CAMPatterns()
+    def __len__(self) -> int:
+        return 0
+    def __getitem__(self, index: int) -> CAMPattern:
+        return None
+    def __iter__(self) -> Iterator[CAMPattern]:
+        return None
+    def item(self, index: int) -> CAMPattern:
+        """
+        Function that returns the specified pattern using an index into the collection.
+        index : The index of the item within the collection to return.  The first item in the collection has an index of 0.
+        Returns the specified item or null if an invalid index was specified.
+        """
+        return CAMPattern()
+    def itemByName(self, name: str) -> CAMPattern:
+        """
+        Returns the pattern with the specified name (as appears in the browser).
+        name : The name (as it appears in the browser) of the pattern.
+        Returns the specified pattern or null in the case where there is no pattern with the specified name.
+        """
+        return CAMPattern()
+    def itemByOperationId(self, id: int) -> CAMPattern:
         """
         Returns the pattern with the specified operation id.
         id : The id of the pattern.
@@ -1714,6 +2302,88 @@ class CreateFromCAMTemplateInput(core.Base):
         Gets and sets the mode to be used for generation. Defaults to Skip Generation.
         """
         pass
+    @property
+    def maxConcurrency(self) -> int:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Gets and sets the maximum number of setups whose geometry selections are resolved at the same time when the input is
+        used with Setups.createFromCAMTemplate. 0 uses the number of processor cores. Defaults to 0.
+        """
+        return int()
+    @maxConcurrency.setter
+    def maxConcurrency(self, value: int):
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Gets and sets the maximum number of setups whose geometry selections are resolved at the same time when the input is
+        used with Setups.createFromCAMTemplate. 0 uses the number of processor cores. Defaults to 0.
+        """
+        pass
+
+class CreateFromCAMTemplateResults(core.Base):
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    Object returned when using the createFromCAMTemplate method of the Setups collection to instantiate a template in
+    many setups. It contains the operations, folders and patterns created in each setup and the error of each setup
+    the template could not be instantiated in.
+    """
+    def __init__(self):
+        pass
+    @staticmethod
+    def cast(arg) -> CreateFromCAMTemplateResults:
+        return CreateFromCAMTemplateResults()
+    @property
+    def setups(self) -> list[Setup]:
+        """
+        Returns the setups the template was instantiated in, in the order they were passed.
+        """
+        return [Setup()]
+    @property
+    def isSuccess(self) -> list[bool]:
+        """
+        Returns whether the template was instantiated successfully in each setup. The array has one entry for each setup, in the order of setups.
+        """
+        return [bool()]
+    @property
+    def errors(self) -> list[str]:
+        """
+        Returns the error message of each setup, or an empty string if the template was instantiated successfully. The array has one entry for each setup, in the order of setups.
+        """
+        return [str()]
+    def operations(self, setupIndex: int) -> list[OperationBase]:
+        """
+        Returns the operations, folders and patterns created from the template in a setup.
+        setupIndex : The index of the setup in setups.
+        Returns an array containing all of the operations, folders and patterns created in the setup.
+        """
+        return [OperationBase()]
+    @property
+    def allOperations(self) -> list[OperationBase]:
+        """
+        Returns the operations, folders and patterns created in all setups, ordered by setup.
+        """
+        return [OperationBase()]
+    @property
+    def generateToolpathFuture(self) -> GenerateToolpathFuture:
+        """
+        Returns the future of the toolpath generation of the created operations, or null if the generation mode of the input
+        did not generate them.
+        """
+        return GenerateToolpathFuture()
+    @property
+    def duration(self) -> float:
+        """
+        Returns the time in seconds spent instantiating the template, excluding the toolpath generation.
+        """
+        return float()
 
 class CurveSelections(core.Base):
     """
@@ -1936,6 +2606,18 @@ class GenerateToolpathFuture(core.Base):
         Returns the number of tasks of operations whose generation is complete.
         """
         return int()
+    @property
+    def operationGenerated(self) -> ToolpathGeneratedEvent:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        The operationGenerated event fires each time the generation of a single operation has finished,
+        successfully or not. The event allows processing generated operations, for instance post processing them,
+        while other operations are still being generated, instead of polling numberOfCompleted.
+        """
+        return ToolpathGeneratedEvent()
 
 class GeometrySelection(core.Base):
     """
@@ -1979,96 +2661,278 @@ class GeometrySelection(core.Base):
         """
         return str()
 
-class Machine(core.Base):
+class KinematicMachiningTime(core.Base):
     """
-    Object that represents a machine.
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    Object returned when using the getKinematicMachiningTime method from the CAM class.
+    Unlike MachiningTime, which assumes every move runs at its programmed feedrate, the times are calculated
+    by walking the moves of the toolpath and limiting the speed by the maximum speed, acceleration and jerk of each
+    machine axis and by the look-ahead and block processing speed of the controller.
+    Moves are indexed the same way as the points of the ToolpathData of the operation: move i ends at point i.
+    The distances, the tool change count and the tool change time are the same as those of MachiningTime.
     """
     def __init__(self):
         pass
     @staticmethod
-    def cast(arg) -> Machine:
-        return Machine()
-    @staticmethod
-    def createFromTemplate(machineTemplate: MachineTemplate) -> Machine:
+    def cast(arg) -> KinematicMachiningTime:
+        return KinematicMachiningTime()
+    @property
+    def machiningTime(self) -> float:
         """
-        Creates a Machine from a template.
-        machineTemplate : The template to act as a base for creating a machine from.
-        Returns the newly created machine with a valid kinematics tree.
+        Gets the machining time in seconds.
         """
-        return Machine()
-    @staticmethod
-    def createFromFile(location: LibraryLocations, filePath: str) -> Machine:
+        return float()
+    @property
+    def feedDistance(self) -> float:
         """
-        Creates a Machine from a file.
-        location : The location in the machine library.
-        filePath : The path to a file to act as a base for creating a machine from.
-        The path is relative to the library location given, unless library location is External,
-        then the filePath is expected to be an absolute path.
-        Returns the newly created machine with a valid kinematics tree.
+        Gets the feed distance in centimeters.
         """
-        return Machine()
-    @staticmethod
-    def create(machineInput: MachineInput) -> Machine:
+        return float()
+    @property
+    def totalFeedTime(self) -> float:
         """
-        Creates a machine from a "MachineInput" input object
-        machineInput : Input object that is used to hold the details needed for creating a machine.
-        Returns the newly created machine in a valid state.
+        Gets the total feed time in seconds.
         """
-        return Machine()
-    def equivalentTo(self, machine: Machine) -> bool:
+        return float()
+    @property
+    def rapidDistance(self) -> float:
         """
-        Checks if the machine is equivalent to this one.
-        machine : The machine to compare this one to
-        True if the machines are equivalent
+        Gets the rapid distance in centimeters.
         """
-        return bool()
-    def clearSimulationModel(self) -> None:
+        return float()
+    @property
+    def totalRapidTime(self) -> float:
         """
-        !!!!! Warning !!!!!
-        ! This is in preview state; please see the help for more info
-        !!!!! Warning !!!!!
-        
-        Clears the simulation model from the machine.
+        Gets the total rapid time in seconds.
         """
-        pass
+        return float()
     @property
-    def vendor(self) -> str:
+    def toolChangeCount(self) -> int:
         """
-        Gets and sets the vendor name of the machine.
+        Gets the number of tool changes.
         """
-        return str()
-    @vendor.setter
-    def vendor(self, value: str):
+        return int()
+    @property
+    def totalToolChangeTime(self) -> float:
         """
-        Gets and sets the vendor name of the machine.
+        Gets the total tool change time in seconds.
         """
-        pass
+        return float()
     @property
-    def model(self) -> str:
+    def operations(self) -> list[OperationBase]:
         """
-        Gets and sets the model name of the machine.
+        Gets the operations that were estimated, in machining order.
         """
-        return str()
-    @model.setter
-    def model(self, value: str):
+        return [OperationBase()]
+    @property
+    def operationTimes(self) -> list[float]:
         """
-        Gets and sets the model name of the machine.
+        Gets the machining time of each operation in seconds, excluding tool changes.
+        The array has the same size and order as the operations array.
         """
-        pass
-    @property
-    def description(self) -> str:
+        return [float()]
+    def moveTimes(self, operationIndex: int, startIndex: int = 0, count: int = -1) -> list[float]:
         """
-        Gets and sets the description of the machine.
+        Gets the time of each move of an operation in seconds.
+        The result is empty if isMoveTimeIncluded was false on the input.
+        operationIndex : The index of the operation in the operations array.
+        startIndex : The index of the first move to return.
+        count : The number of moves to return. Use -1 to return all moves from startIndex to the end of the toolpath.
+        Returns an array of count values.
         """
-        return str()
-    @description.setter
-    def description(self, value: str):
+        return [float()]
+    def achievedFeedrates(self, operationIndex: int, startIndex: int = 0, count: int = -1) -> list[float]:
         """
-        Gets and sets the description of the machine.
+        Gets the average feedrate achieved during each move of an operation in centimeters per second.
+        The result is empty if isMoveTimeIncluded was false on the input.
+        operationIndex : The index of the operation in the operations array.
+        startIndex : The index of the first move to return.
+        count : The number of moves to return. Use -1 to return all moves from startIndex to the end of the toolpath.
+        Returns an array of count values.
         """
-        pass
-    @property
-    def id(self) -> str:
+        return [float()]
+    def limitingFactors(self, operationIndex: int, startIndex: int = 0, count: int = -1) -> list[int]:
+        """
+        Gets what limited the speed of each move of an operation. The values are obtained from the
+        MachiningTimeLimitingFactors enum and returned as integers.
+        The result is empty if isMoveTimeIncluded was false on the input.
+        operationIndex : The index of the operation in the operations array.
+        startIndex : The index of the first move to return.
+        count : The number of moves to return. Use -1 to return all moves from startIndex to the end of the toolpath.
+        Returns an array of count values.
+        """
+        return [int()]
+
+class KinematicMachiningTimeInput(core.Base):
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    Defines the operations and the options for a kinematic machining time estimate.
+    Use the CAM.createKinematicMachiningTimeInput method to create a new input object and pass it to
+    the CAM.getKinematicMachiningTime method.
+    """
+    def __init__(self):
+        pass
+    @staticmethod
+    def cast(arg) -> KinematicMachiningTimeInput:
+        return KinematicMachiningTimeInput()
+    @property
+    def operations(self) -> core.Base:
+        """
+        Returns the Operation, Setup, Folder, or Pattern object or the ObjectCollection of these objects
+        the input was created for.
+        """
+        return core.Base()
+    @property
+    def machine(self) -> Machine:
+        """
+        Gets and sets the machine whose axis speeds, accelerations, jerks and controller look-ahead are used.
+        Null by default, which uses the machine of the parent setup of each operation.
+        """
+        return Machine()
+    @machine.setter
+    def machine(self, value: Machine):
+        """
+        Gets and sets the machine whose axis speeds, accelerations, jerks and controller look-ahead are used.
+        Null by default, which uses the machine of the parent setup of each operation.
+        """
+        pass
+    @property
+    def feedScale(self) -> float:
+        """
+        Gets and sets the feed scale value (%) to use. 100 by default.
+        """
+        return float()
+    @feedScale.setter
+    def feedScale(self, value: float):
+        """
+        Gets and sets the feed scale value (%) to use. 100 by default.
+        """
+        pass
+    @property
+    def toolChangeTime(self) -> float:
+        """
+        Gets and sets the tool change time in seconds. 0 by default.
+        """
+        return float()
+    @toolChangeTime.setter
+    def toolChangeTime(self, value: float):
+        """
+        Gets and sets the tool change time in seconds. 0 by default.
+        """
+        pass
+    @property
+    def isMoveTimeIncluded(self) -> bool:
+        """
+        Gets and sets whether the time, feedrate and limiting factor of every single move are kept in the result.
+        Leave this off if only the totals and the times per operation are needed, to reduce the memory used by the result.
+        False by default.
+        """
+        return bool()
+    @isMoveTimeIncluded.setter
+    def isMoveTimeIncluded(self, value: bool):
+        """
+        Gets and sets whether the time, feedrate and limiting factor of every single move are kept in the result.
+        Leave this off if only the totals and the times per operation are needed, to reduce the memory used by the result.
+        False by default.
+        """
+        pass
+
+class Machine(core.Base):
+    """
+    Object that represents a machine.
+    """
+    def __init__(self):
+        pass
+    @staticmethod
+    def cast(arg) -> Machine:
+        return Machine()
+    @staticmethod
+    def createFromTemplate(machineTemplate: MachineTemplate) -> Machine:
+        """
+        Creates a Machine from a template.
+        machineTemplate : The template to act as a base for creating a machine from.
+        Returns the newly created machine with a valid kinematics tree.
+        """
+        return Machine()
+    @staticmethod
+    def createFromFile(location: LibraryLocations, filePath: str) -> Machine:
+        """
+        Creates a Machine from a file.
+        location : The location in the machine library.
+        filePath : The path to a file to act as a base for creating a machine from.
+        The path is relative to the library location given, unless library location is External,
+        then the filePath is expected to be an absolute path.
+        Returns the newly created machine with a valid kinematics tree.
+        """
+        return Machine()
+    @staticmethod
+    def create(machineInput: MachineInput) -> Machine:
+        """
+        Creates a machine from a "MachineInput" input object
+        machineInput : Input object that is used to hold the details needed for creating a machine.
+        Returns the newly created machine in a valid state.
+        """
+        return Machine()
+    def equivalentTo(self, machine: Machine) -> bool:
+        """
+        Checks if the machine is equivalent to this one.
+        machine : The machine to compare this one to
+        True if the machines are equivalent
+        """
+        return bool()
+    def clearSimulationModel(self) -> None:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Clears the simulation model from the machine.
+        """
+        pass
+    @property
+    def vendor(self) -> str:
+        """
+        Gets and sets the vendor name of the machine.
+        """
+        return str()
+    @vendor.setter
+    def vendor(self, value: str):
+        """
+        Gets and sets the vendor name of the machine.
+        """
+        pass
+    @property
+    def model(self) -> str:
+        """
+        Gets and sets the model name of the machine.
+        """
+        return str()
+    @model.setter
+    def model(self, value: str):
+        """
+        Gets and sets the model name of the machine.
+        """
+        pass
+    @property
+    def description(self) -> str:
+        """
+        Gets and sets the description of the machine.
+        """
+        return str()
+    @description.setter
+    def description(self, value: str):
+        """
+        Gets and sets the description of the machine.
+        """
+        pass
+    @property
+    def id(self) -> str:
         """
         Gets the unique identifier of the machine.
         Can be used for comparing machines within the document.
@@ -2117,6 +2981,17 @@ class Machine(core.Base):
         Returns true if the machine has a simulation model attached.
         """
         return bool()
+    def createKinematicsSolver(self) -> MachineKinematicsSolver:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Creates a solver for the inverse kinematics of this machine, which checks moves for axis limit violations,
+        singularities and rotary unwinds before post processing.
+        Returns the solver or null if the machine has no kinematics.
+        """
+        return MachineKinematicsSolver()
 
 class MachineAvoidGroups(core.Base):
     """
@@ -2363,6 +3238,50 @@ class MachineAxisConfiguration(core.Base):
         Coordinate to use for post processing.
         """
         pass
+    @property
+    def maxAcceleration(self) -> float:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Specifies the maximum acceleration for this axis. 0 means the acceleration is not limited.
+        Units are cm/s^2 for linear axes or rad/s^2 for rotary axes.
+        """
+        return float()
+    @maxAcceleration.setter
+    def maxAcceleration(self, value: float):
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Specifies the maximum acceleration for this axis. 0 means the acceleration is not limited.
+        Units are cm/s^2 for linear axes or rad/s^2 for rotary axes.
+        """
+        pass
+    @property
+    def maxJerk(self) -> float:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Specifies the maximum jerk for this axis. 0 means the jerk is not limited.
+        Units are cm/s^3 for linear axes or rad/s^3 for rotary axes.
+        """
+        return float()
+    @maxJerk.setter
+    def maxJerk(self, value: float):
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Specifies the maximum jerk for this axis. 0 means the jerk is not limited.
+        Units are cm/s^3 for linear axes or rad/s^3 for rotary axes.
+        """
+        pass
 
 class MachineAxisConfigurations(core.Base):
     """
@@ -2833,6 +3752,170 @@ class MachineItem(core.Base):
         """
         return MachinePart()
 
+class MachineKinematicsSolution(core.Base):
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    The axis values solved by a MachineKinematicsSolver for a sequence of moves, together with the issues found.
+    Moves are indexed in the order of the input: move i ends at position i. When solving an operation, this is
+    the same index as the points of the ToolpathData of the operation.
+    """
+    def __init__(self):
+        pass
+    @staticmethod
+    def cast(arg) -> MachineKinematicsSolution:
+        return MachineKinematicsSolution()
+    @property
+    def moveCount(self) -> int:
+        """
+        Returns the number of moves that were solved.
+        """
+        return int()
+    @property
+    def axisCount(self) -> int:
+        """
+        Returns the number of axis values of each move, which is the size of MachineKinematicsSolver.axisNames.
+        """
+        return int()
+    @property
+    def isReachable(self) -> bool:
+        """
+        Returns true if every move could be solved without exceeding the range of an axis.
+        """
+        return bool()
+    def axisValues(self, startIndex: int = 0, count: int = -1) -> list[float]:
+        """
+        Returns the axis values of each move, in the order of MachineKinematicsSolver.axisNames. Linear axes are in centimeters
+        and rotary axes in radians. Of the possible solutions of each move, the one closest to the previous move is chosen.
+        startIndex : The index of the first move to return.
+        count : The number of moves to return. Use -1 to return all moves from startIndex to the end.
+        Returns an array of axisCount * count values.
+        """
+        return [float()]
+    def singularityDistances(self, startIndex: int = 0, count: int = -1) -> list[float]:
+        """
+        Returns the angle in radians between the tool axis of each move and the nearest singularity of the machine.
+        startIndex : The index of the first move to return.
+        count : The number of moves to return. Use -1 to return all moves from startIndex to the end.
+        Returns an array of count values.
+        """
+        return [float()]
+    @property
+    def issueCount(self) -> int:
+        """
+        Returns the number of issues found.
+        """
+        return int()
+    def issueMoveIndices(self, startIndex: int = 0, count: int = -1) -> list[int]:
+        """
+        Returns the index of the move of each issue.
+        startIndex : The index of the first issue to return.
+        count : The number of issues to return. Use -1 to return all issues from startIndex to the end.
+        Returns an array of count values.
+        """
+        return [int()]
+    def issueTypes(self, startIndex: int = 0, count: int = -1) -> list[int]:
+        """
+        Returns the type of each issue. The values are obtained from the MachineKinematicsIssueTypes enum and returned as integers.
+        startIndex : The index of the first issue to return.
+        count : The number of issues to return. Use -1 to return all issues from startIndex to the end.
+        Returns an array of count values.
+        """
+        return [int()]
+    def issueAxisIndices(self, startIndex: int = 0, count: int = -1) -> list[int]:
+        """
+        Returns the index into MachineKinematicsSolver.axisNames of the axis of each issue, or -1 if the issue is not related to a single axis.
+        startIndex : The index of the first issue to return.
+        count : The number of issues to return. Use -1 to return all issues from startIndex to the end.
+        Returns an array of count values.
+        """
+        return [int()]
+    def issueValues(self, startIndex: int = 0, count: int = -1) -> list[float]:
+        """
+        Returns a value describing the severity of each issue: the distance beyond the range of the axis for axis limit issues,
+        the distance to the singularity for singularity issues and the angle the rotary axis turns back for unwind issues.
+        Linear values are in centimeters and angles in radians.
+        startIndex : The index of the first issue to return.
+        count : The number of issues to return. Use -1 to return all issues from startIndex to the end.
+        Returns an array of count values.
+        """
+        return [float()]
+
+class MachineKinematicsSolver(core.Base):
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    Solves the inverse kinematics of a machine: the values of the linear and rotary axes that put the tool tip at a
+    position with a tool axis. The kinematic chain is built from the parts and axes of the kinematics element of the machine.
+    Use the Machine.createKinematicsSolver method to create a solver.
+    Positions and tool axes are defined in the coordinate system of the workpiece on the machine.
+    """
+    def __init__(self):
+        pass
+    @staticmethod
+    def cast(arg) -> MachineKinematicsSolver:
+        return MachineKinematicsSolver()
+    @property
+    def machine(self) -> Machine:
+        """
+        Returns the machine the solver was created for.
+        """
+        return Machine()
+    @property
+    def axisNames(self) -> list[str]:
+        """
+        Returns the names of the axes in the order their values are returned by the solver.
+        """
+        return [str()]
+    @property
+    def initialAxisValues(self) -> list[float]:
+        """
+        Gets and sets the axis values the first move is solved from, in the order of axisNames.
+        Defaults to the home position of each axis.
+        """
+        return [float()]
+    @initialAxisValues.setter
+    def initialAxisValues(self, value: list[float]):
+        """
+        Gets and sets the axis values the first move is solved from, in the order of axisNames.
+        Defaults to the home position of each axis.
+        """
+        pass
+    @property
+    def singularityCone(self) -> float:
+        """
+        Gets and sets the angle in radians around a singularity within which a singularity issue is reported.
+        Defaults to the cone of the singularity settings of the multi-axis element of the machine.
+        """
+        return float()
+    @singularityCone.setter
+    def singularityCone(self, value: float):
+        """
+        Gets and sets the angle in radians around a singularity within which a singularity issue is reported.
+        Defaults to the cone of the singularity settings of the multi-axis element of the machine.
+        """
+        pass
+    def solve(self, positions: list[float], toolAxes: list[float]) -> MachineKinematicsSolution:
+        """
+        Solves a sequence of moves. The moves are solved in order so that the rotary axes move continuously from one move to the next.
+        positions : The tool tip positions as an array of doubles where they are the x, y, z components of each point, in centimeters.
+        toolAxes : The tool axes as an array of doubles where they are the x, y, z components of each unit vector.
+        The array must have the same size as positions.
+        Returns the solution or null if the solve failed.
+        """
+        return MachineKinematicsSolution()
+    def solveOperation(self, operation: OperationBase) -> MachineKinematicsSolution:
+        """
+        Solves all moves of the toolpath of an operation. The operation has to be generated.
+        operation : The operation to solve. The workpiece is placed on the machine as defined by the parent setup of the operation.
+        Returns the solution or null if the solve failed.
+        """
+        return MachineKinematicsSolution()
+
 class MachinePart(core.Base):
     """
     Object representing some part of a machine, such as the static base of the machine, an
@@ -4053,9 +5136,55 @@ class NCProgramInput(core.Base):
         """
         pass
 
-class NCProgramPostProcessOptions(core.Base):
+class NCProgramPostProcessFuture(core.Base):
     """
-    The NCProgramPostProcessOptions provides settings to control the post processing of NC programs.
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    Used to check the state and get back the results of post processing several NC programs in parallel.
+    The NC code is written to the output folder of each NC program in chunks while it is generated,
+    so output files grow during post processing and are complete once the result of the NC program is available.
+    """
+    def __init__(self):
+        pass
+    @staticmethod
+    def cast(arg) -> NCProgramPostProcessFuture:
+        return NCProgramPostProcessFuture()
+    @property
+    def numberOfNCPrograms(self) -> int:
+        """
+        Returns the number of NC programs that are post processed.
+        """
+        return int()
+    @property
+    def numberOfCompleted(self) -> int:
+        """
+        Returns the number of NC programs whose post processing is complete.
+        """
+        return int()
+    @property
+    def isPostProcessingCompleted(self) -> bool:
+        """
+        Returns true if all NC programs are post processed.
+        """
+        return bool()
+    @property
+    def bytesWritten(self) -> int:
+        """
+        Returns the number of bytes written to the output files of all NC programs so far.
+        """
+        return int()
+    @property
+    def results(self) -> list[NCProgramPostProcessResult]:
+        """
+        Returns the results of the NC programs whose post processing is complete, in the order they completed.
+        """
+        return [NCProgramPostProcessResult()]
+
+class NCProgramPostProcessOptions(core.Base):
+    """
+    The NCProgramPostProcessOptions provides settings to control the post processing of NC programs.
     It is needed for the NCPrograms.postProcess method for posting toolpaths and generating CNC files and setup sheets.
     """
     def __init__(self):
@@ -4115,6 +5244,112 @@ class NCProgramPostProcessOptions(core.Base):
         Uses fusionHubExecutionBehavior_ExportWithRelationship by default.
         """
         pass
+    @property
+    def maxConcurrency(self) -> int:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Gets and sets the maximum number of NC programs that are post processed at the same time by NCPrograms.postProcessInParallel.
+        Each NC program is post processed by its own post engine instance.
+        0 uses the number of processor cores. 0 by default. Ignored by NCProgram.postProcess.
+        """
+        return int()
+    @maxConcurrency.setter
+    def maxConcurrency(self, value: int):
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Gets and sets the maximum number of NC programs that are post processed at the same time by NCPrograms.postProcessInParallel.
+        Each NC program is post processed by its own post engine instance.
+        0 uses the number of processor cores. 0 by default. Ignored by NCProgram.postProcess.
+        """
+        pass
+    @property
+    def isOfflineOnly(self) -> bool:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Gets and sets whether post processing is restricted to post configurations that are available without a network connection,
+        like the posts in the local post folder (CAMLibraryManager.localPostFolder).
+        If true, NC programs using a post configuration that would have to be downloaded fail instead.
+        False by default.
+        """
+        return bool()
+    @isOfflineOnly.setter
+    def isOfflineOnly(self, value: bool):
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Gets and sets whether post processing is restricted to post configurations that are available without a network connection,
+        like the posts in the local post folder (CAMLibraryManager.localPostFolder).
+        If true, NC programs using a post configuration that would have to be downloaded fail instead.
+        False by default.
+        """
+        pass
+
+class NCProgramPostProcessResult(core.Base):
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    The result of post processing a single NC program with NCPrograms.postProcessInParallel.
+    """
+    def __init__(self):
+        pass
+    @staticmethod
+    def cast(arg) -> NCProgramPostProcessResult:
+        return NCProgramPostProcessResult()
+    @property
+    def ncProgram(self) -> NCProgram:
+        """
+        Returns the NC program this result is for.
+        """
+        return NCProgram()
+    @property
+    def isSuccess(self) -> bool:
+        """
+        Returns true if the NC program was post processed successfully.
+        """
+        return bool()
+    @property
+    def error(self) -> str:
+        """
+        Returns the error message if post processing failed, or an empty string otherwise.
+        """
+        return str()
+    @property
+    def warnings(self) -> list[str]:
+        """
+        Returns the warnings reported by the post processor.
+        """
+        return [str()]
+    @property
+    def duration(self) -> float:
+        """
+        Returns the time in seconds spent post processing the NC program.
+        """
+        return float()
+    @property
+    def outputSize(self) -> int:
+        """
+        Returns the total size in bytes of the files written for the NC program.
+        """
+        return int()
+    @property
+    def outputFiles(self) -> list[str]:
+        """
+        Returns the full paths of the files written for the NC program.
+        """
+        return [str()]
 
 class NCPrograms(core.Base):
     """
@@ -4174,6 +5409,20 @@ class NCPrograms(core.Base):
         The number of items in the collection.
         """
         return int()
+    def postProcessInParallel(self, ncPrograms: list[NCProgram], options: NCProgramPostProcessOptions) -> NCProgramPostProcessFuture:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Post processes several NC programs at the same time, each in an isolated post engine instance.
+        The method returns immediately; use the returned future to follow the progress and get the result of each NC program.
+        ncPrograms : The NC programs to post process. Each NC program must have a post configuration.
+        options : NCProgramPostProcessOptions to specify the behavior on internal warnings and the maximum concurrency.
+        Can be null if the default values should be used.
+        Returns an NCProgramPostProcessFuture object to check the state of the post processing.
+        """
+        return NCProgramPostProcessFuture()
 
 class OperationBase(core.Base):
     """
@@ -4428,6 +5677,19 @@ class OperationBase(core.Base):
         null if the given object does not have available generated data, an instance in one of the child classes otherwise.
         """
         return GeneratedDataCollection()
+    @property
+    def referencedEntities(self) -> list[core.Base]:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Returns the faces and bodies the toolpath of this operation depends on. This includes the geometry referenced
+        by the geometry selections of the operation, the model bodies of the parent setup and the bodies the stock
+        of the parent setup is derived from. The entity tokens of the faces and the revision ids of the bodies
+        are recorded when the operation is generated and used to detect which operations are affected by a change.
+        """
+        return [core.Base()]
 
 class OperationInput(core.Base):
     """
@@ -4794,6 +6056,222 @@ class OptimizedOrientationResult(core.Base):
         """
         return core.Matrix3D()
 
+class OrientationScores(core.Base):
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    Object returned when using the scoreOrientations method from the OptimizedOrientationResults class.
+    The measures of all scored orientations are available as parallel arrays. Each measure is normalized by its range over
+    all orientations before it is weighted, and the objective value is the sum of the weighted measures, so lower is better.
+    """
+    def __init__(self):
+        pass
+    @staticmethod
+    def cast(arg) -> OrientationScores:
+        return OrientationScores()
+    @property
+    def count(self) -> int:
+        """
+        Returns the number of scored orientations.
+        """
+        return int()
+    @property
+    def duration(self) -> float:
+        """
+        Returns the time in seconds spent scoring the orientations.
+        """
+        return float()
+    @property
+    def directions(self) -> list[float]:
+        """
+        Returns the scored orientations as an array of doubles where they are the x, y, z components of each direction.
+        """
+        return [float()]
+    @property
+    def overhangAreas(self) -> list[float]:
+        """
+        Returns the area in square centimeters of the triangles needing support. The array has one entry for each scored orientation.
+        """
+        return [float()]
+    @property
+    def supportVolumes(self) -> list[float]:
+        """
+        Returns the volume in cubic centimeters between the overhanging triangles and the build plate or the part below. The array has one entry for each scored orientation.
+        """
+        return [float()]
+    @property
+    def footprintAreas(self) -> list[float]:
+        """
+        Returns the area in square centimeters of the projection of the part onto the build plate. The array has one entry for each scored orientation.
+        """
+        return [float()]
+    @property
+    def buildHeights(self) -> list[float]:
+        """
+        Returns the height in centimeters of the oriented part. The array has one entry for each scored orientation.
+        """
+        return [float()]
+    @property
+    def centerOfGravityHeights(self) -> list[float]:
+        """
+        Returns the height in centimeters of the center of gravity of the oriented part. The array has one entry for each scored orientation.
+        """
+        return [float()]
+    @property
+    def objectiveValues(self) -> list[float]:
+        """
+        Returns the weighted objective value. The array has one entry for each scored orientation.
+        """
+        return [float()]
+    @property
+    def rankedIndices(self) -> list[int]:
+        """
+        Returns the indices of the orientations ordered by their objective value, best first.
+        """
+        return [int()]
+    def createResult(self, index: int) -> OptimizedOrientationResult:
+        """
+        Creates an orientation result for a scored orientation. Set the result as the currentOrientationResult of the
+        OptimizedOrientationResults the scores were calculated for to apply the orientation to the occurrence.
+        The rotation about the build direction is chosen to minimize the bounding box volume.
+        index : The index of the orientation.
+        Returns the orientation result or null if the index is invalid.
+        """
+        return OptimizedOrientationResult()
+
+class OrientationScoringInput(core.Base):
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    Defines the candidate orientations and the weights used by OptimizedOrientationResults.scoreOrientations.
+    Use the OptimizedOrientationResults.createScoringInput method to create a new input object.
+    Orientations are described by the direction of the part, in the coordinate system of the occurrence at the time of the
+    calculation, that points up along the build direction after the part is oriented.
+    """
+    def __init__(self):
+        pass
+    @staticmethod
+    def cast(arg) -> OrientationScoringInput:
+        return OrientationScoringInput()
+    @property
+    def sampleCount(self) -> int:
+        """
+        Gets and sets the number of orientations sampled evenly over the unit sphere. Ignored if directions is not empty. 1000 by default.
+        """
+        return int()
+    @sampleCount.setter
+    def sampleCount(self, value: int):
+        """
+        Gets and sets the number of orientations sampled evenly over the unit sphere. Ignored if directions is not empty. 1000 by default.
+        """
+        pass
+    @property
+    def directions(self) -> list[float]:
+        """
+        Gets and sets the orientations to score as an array of doubles where they are the x, y, z components of each direction.
+        Empty by default, which samples sampleCount directions over the unit sphere.
+        """
+        return [float()]
+    @directions.setter
+    def directions(self, value: list[float]):
+        """
+        Gets and sets the orientations to score as an array of doubles where they are the x, y, z components of each direction.
+        Empty by default, which samples sampleCount directions over the unit sphere.
+        """
+        pass
+    @property
+    def overhangAngle(self) -> float:
+        """
+        Gets and sets the angle in radians between a downward facing triangle and the build plate below which the triangle needs support.
+        Defaults to the overhang angle of the parent orientation operation.
+        """
+        return float()
+    @overhangAngle.setter
+    def overhangAngle(self, value: float):
+        """
+        Gets and sets the angle in radians between a downward facing triangle and the build plate below which the triangle needs support.
+        Defaults to the overhang angle of the parent orientation operation.
+        """
+        pass
+    @property
+    def overhangAreaWeight(self) -> float:
+        """
+        Gets and sets the weight of the overhang area in the objective value. 1 by default.
+        """
+        return float()
+    @overhangAreaWeight.setter
+    def overhangAreaWeight(self, value: float):
+        """
+        Gets and sets the weight of the overhang area in the objective value. 1 by default.
+        """
+        pass
+    @property
+    def supportVolumeWeight(self) -> float:
+        """
+        Gets and sets the weight of the support volume in the objective value. 1 by default.
+        """
+        return float()
+    @supportVolumeWeight.setter
+    def supportVolumeWeight(self, value: float):
+        """
+        Gets and sets the weight of the support volume in the objective value. 1 by default.
+        """
+        pass
+    @property
+    def footprintAreaWeight(self) -> float:
+        """
+        Gets and sets the weight of the footprint area on the build plate in the objective value. 0 by default.
+        """
+        return float()
+    @footprintAreaWeight.setter
+    def footprintAreaWeight(self, value: float):
+        """
+        Gets and sets the weight of the footprint area on the build plate in the objective value. 0 by default.
+        """
+        pass
+    @property
+    def buildHeightWeight(self) -> float:
+        """
+        Gets and sets the weight of the build height in the objective value. 1 by default.
+        """
+        return float()
+    @buildHeightWeight.setter
+    def buildHeightWeight(self, value: float):
+        """
+        Gets and sets the weight of the build height in the objective value. 1 by default.
+        """
+        pass
+    @property
+    def centerOfGravityHeightWeight(self) -> float:
+        """
+        Gets and sets the weight of the height of the center of gravity in the objective value. 0 by default.
+        """
+        return float()
+    @centerOfGravityHeightWeight.setter
+    def centerOfGravityHeightWeight(self, value: float):
+        """
+        Gets and sets the weight of the height of the center of gravity in the objective value. 0 by default.
+        """
+        pass
+    @property
+    def maxConcurrency(self) -> int:
+        """
+        Gets and sets the maximum number of threads used to score the orientations.
+        0 uses the number of processor cores. 0 by default.
+        """
+        return int()
+    @maxConcurrency.setter
+    def maxConcurrency(self, value: int):
+        """
+        Gets and sets the maximum number of threads used to score the orientations.
+        0 uses the number of processor cores. 0 by default.
+        """
+        pass
+
 class ParameterValue(core.Base):
     """
     Base class for representing the value of a parameter.
@@ -5117,95 +6595,421 @@ class PrintSettingQuery(core.Base):
     @name.setter
     def name(self, value: str):
         """
-        The case-insensitive name specifies the name of the PrintSetting.
+        The case-insensitive name specifies the name of the PrintSetting.
+        """
+        pass
+    @property
+    def technology(self) -> str:
+        """
+        The case-insensitive technology specifies technology of the PrintSetting.
+        """
+        return str()
+    @technology.setter
+    def technology(self, value: str):
+        """
+        The case-insensitive technology specifies technology of the PrintSetting.
+        """
+        pass
+    @property
+    def vendor(self) -> str:
+        """
+        The case-insensitive vendor specifies vendor of the PrintSetting. Generic FFF PrintSetting doesnt have a vendor.
+        """
+        return str()
+    @vendor.setter
+    def vendor(self, value: str):
+        """
+        The case-insensitive vendor specifies vendor of the PrintSetting. Generic FFF PrintSetting doesnt have a vendor.
+        """
+        pass
+    @property
+    def material(self) -> str:
+        """
+        The case-insensitive material specifies material of the MPBF PrintSetting.
+        """
+        return str()
+    @material.setter
+    def material(self, value: str):
+        """
+        The case-insensitive material specifies material of the MPBF PrintSetting.
+        """
+        pass
+    @property
+    def layerHeight(self) -> float:
+        """
+        The layer height specifies layer height of the PrintSetting. This should match the PrintSetting layer height in cm.
+        """
+        return float()
+    @layerHeight.setter
+    def layerHeight(self, value: float):
+        """
+        The layer height specifies layer height of the PrintSetting. This should match the PrintSetting layer height in cm.
+        """
+        pass
+    @property
+    def url(self) -> core.URL:
+        """
+        The URL specifies the location and folder to search for in the PrintSetting library.
+        Setting the URL updates the location.
+        """
+        return core.URL()
+    @url.setter
+    def url(self, value: core.URL):
+        """
+        The URL specifies the location and folder to search for in the PrintSetting library.
+        Setting the URL updates the location.
+        """
+        pass
+    @property
+    def location(self) -> LibraryLocations:
+        """
+        The location specifies the location to search in the PrintSetting library.
+        Setting the location clears any previous specified URL.
+        """
+        return LibraryLocations()
+    @location.setter
+    def location(self, value: LibraryLocations):
+        """
+        The location specifies the location to search in the PrintSetting library.
+        Setting the location clears any previous specified URL.
+        """
+        pass
+    @property
+    def machine(self) -> Machine:
+        """
+        The machine specifies which machine the found print setting are compatible with.
+        """
+        return Machine()
+    @machine.setter
+    def machine(self, value: Machine):
+        """
+        The machine specifies which machine the found print setting are compatible with.
+        """
+        pass
+
+class RecognizedFeatures(core.Base):
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    The holes and pockets recognized on several bodies, as flat arrays instead of individual objects.
+    Holes are ordered by body and pockets by body and attack vector. The segments of all holes are stored one after another,
+    as are the boundaries of all pockets, the points of all boundaries and the faces of all pockets; the start indices
+    arrays give the index of the first item of each hole, pocket or boundary.
+    Faces are identified by their tempId, which is unique within the body of the hole or pocket.
+    """
+    def __init__(self):
+        pass
+    @staticmethod
+    def cast(arg) -> RecognizedFeatures:
+        return RecognizedFeatures()
+    @staticmethod
+    def recognizeFeatures(input: RecognizedFeaturesInput) -> RecognizedFeatures:
+        """
+        Recognizes the holes and pockets on all bodies of the input. Bodies and attack vectors are processed in parallel.
+        input : Input object that contains the bodies, attack vectors and settings.
+        Returns the recognized holes and pockets or null if the recognition failed.
+        """
+        return RecognizedFeatures()
+    @property
+    def duration(self) -> float:
+        """
+        Returns the time in seconds spent recognizing the features.
+        """
+        return float()
+    @property
+    def holeCount(self) -> int:
+        """
+        Returns the number of holes recognized on all bodies.
+        """
+        return int()
+    @property
+    def holeBodyIndices(self) -> list[int]:
+        """
+        Returns the index into the bodies of the input of the body of each hole. The array has one entry for each hole.
+        """
+        return [int()]
+    @property
+    def holeAxes(self) -> list[float]:
+        """
+        Returns the unit vector that points straight up out of each hole, as an array of doubles where they are the x, y, z components
+        of each vector.
+        """
+        return [float()]
+    @property
+    def holeTops(self) -> list[float]:
+        """
+        Returns the center of the top of each hole in centimeters, as an array of doubles where they are the x, y, z components of each point.
+        """
+        return [float()]
+    @property
+    def holeBottoms(self) -> list[float]:
+        """
+        Returns the center of the bottom of each hole in centimeters, as an array of doubles where they are the x, y, z components of each point.
+        """
+        return [float()]
+    @property
+    def holeTopDiameters(self) -> list[float]:
+        """
+        Returns the top diameter of each hole in centimeters. The array has one entry for each hole.
+        """
+        return [float()]
+    @property
+    def holeBottomDiameters(self) -> list[float]:
+        """
+        Returns the bottom diameter of each hole in centimeters. The array has one entry for each hole.
+        """
+        return [float()]
+    @property
+    def holeLengths(self) -> list[float]:
+        """
+        Returns the total length of each hole in centimeters. The array has one entry for each hole.
+        """
+        return [float()]
+    @property
+    def holeIsThrough(self) -> list[bool]:
+        """
+        Returns whether each hole is a through hole. The array has one entry for each hole.
+        """
+        return [bool()]
+    @property
+    def holeIsThreaded(self) -> list[bool]:
+        """
+        Returns whether at least one segment of each hole is threaded. The array has one entry for each hole.
+        """
+        return [bool()]
+    @property
+    def holeSegmentStartIndices(self) -> list[int]:
+        """
+        Returns the index of the first segment of each hole. The segments of a hole are ordered from top to bottom. The array has one entry for each hole.
+        """
+        return [int()]
+    @property
+    def segmentTypes(self) -> list[int]:
+        """
+        Returns the type of each hole segment. The values are obtained from the HoleSegmentType enum and returned as integers. The array has one entry for each hole segment.
+        """
+        return [int()]
+    @property
+    def segmentTopDiameters(self) -> list[float]:
+        """
+        Returns the top diameter of each hole segment in centimeters. The array has one entry for each hole segment.
+        """
+        return [float()]
+    @property
+    def segmentBottomDiameters(self) -> list[float]:
+        """
+        Returns the bottom diameter of each hole segment in centimeters. The array has one entry for each hole segment.
+        """
+        return [float()]
+    @property
+    def segmentHeights(self) -> list[float]:
+        """
+        Returns the height of each hole segment in centimeters. The array has one entry for each hole segment.
+        """
+        return [float()]
+    @property
+    def segmentIsThreaded(self) -> list[bool]:
+        """
+        Returns whether each hole segment is threaded. The array has one entry for each hole segment.
+        """
+        return [bool()]
+    @property
+    def segmentFaceTempIds(self) -> list[int]:
+        """
+        Returns the tempId of the face of each hole segment. The array has one entry for each hole segment.
+        """
+        return [int()]
+    @property
+    def pocketCount(self) -> int:
+        """
+        Returns the number of pockets recognized on all bodies for all attack vectors.
+        """
+        return int()
+    @property
+    def pocketBodyIndices(self) -> list[int]:
+        """
+        Returns the index into the bodies of the input of the body of each pocket. The array has one entry for each pocket.
+        """
+        return [int()]
+    @property
+    def pocketAttackVectorIndices(self) -> list[int]:
+        """
+        Returns the index of the attack vector each pocket was recognized for. The array has one entry for each pocket.
+        """
+        return [int()]
+    @property
+    def pocketDepths(self) -> list[float]:
+        """
+        Returns the depth of each pocket in centimeters. The array has one entry for each pocket.
+        """
+        return [float()]
+    @property
+    def pocketIsThrough(self) -> list[bool]:
+        """
+        Returns whether each pocket is a through pocket. The array has one entry for each pocket.
+        """
+        return [bool()]
+    @property
+    def pocketIsClosed(self) -> list[bool]:
+        """
+        Returns whether the outer boundary of each pocket is a single closed curve. The array has one entry for each pocket.
+        """
+        return [bool()]
+    @property
+    def pocketBottomTypes(self) -> list[int]:
+        """
+        Returns the type of the bottom edge of each pocket. The values are obtained from the RecognizedPocketBottomType enum
+        and returned as integers. The array has one entry for each pocket.
+        """
+        return [int()]
+    @property
+    def pocketBoundaryStartIndices(self) -> list[int]:
+        """
+        Returns the index of the first boundary of each pocket. The outer boundaries of a pocket come before its islands. The array has one entry for each pocket.
+        """
+        return [int()]
+    @property
+    def boundaryIsIsland(self) -> list[bool]:
+        """
+        Returns whether each boundary is an island rather than an outer boundary. The array has one entry for each boundary.
+        """
+        return [bool()]
+    @property
+    def boundaryPointStartIndices(self) -> list[int]:
+        """
+        Returns the index of the first point of each boundary. The array has one entry for each boundary.
+        """
+        return [int()]
+    @property
+    def boundaryPoints(self) -> list[float]:
+        """
+        Returns the points of the polylines approximating all boundaries in centimeters, as an array of doubles where they are
+        the x, y, z components of each point.
+        """
+        return [float()]
+    @property
+    def pocketFaceStartIndices(self) -> list[int]:
+        """
+        Returns the index of the first face of each pocket in pocketFaceTempIds. The array has one entry for each pocket.
+        """
+        return [int()]
+    @property
+    def pocketFaceTempIds(self) -> list[int]:
+        """
+        Returns the tempIds of the faces making up each pocket.
+        """
+        return [int()]
+
+class RecognizedFeaturesInput(core.Base):
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    Object that contains the bodies, attack vectors and settings used by RecognizedFeatures.recognizeFeatures.
+    """
+    def __init__(self):
+        pass
+    @staticmethod
+    def cast(arg) -> RecognizedFeaturesInput:
+        return RecognizedFeaturesInput()
+    @staticmethod
+    def create() -> RecognizedFeaturesInput:
+        """
+        Creates an empty input object to be passed into RecognizedFeatures.recognizeFeatures.
+        The newly created input object.
         """
-        pass
+        return RecognizedFeaturesInput()
     @property
-    def technology(self) -> str:
+    def bodies(self) -> list[core.Base]:
         """
-        The case-insensitive technology specifies technology of the PrintSetting.
+        Gets and sets the model bodies on which to recognize holes and pockets.
         """
-        return str()
-    @technology.setter
-    def technology(self, value: str):
+        return [core.Base()]
+    @bodies.setter
+    def bodies(self, value: list[core.Base]):
         """
-        The case-insensitive technology specifies technology of the PrintSetting.
+        Gets and sets the model bodies on which to recognize holes and pockets.
         """
         pass
     @property
-    def vendor(self) -> str:
+    def attackVectors(self) -> list[float]:
         """
-        The case-insensitive vendor specifies vendor of the PrintSetting. Generic FFF PrintSetting doesnt have a vendor.
+        Gets and sets the vectors defining the orientations in which to search for pockets, as an array of doubles where they
+        are the x, y, z components of each vector. Each vector points down along the tool towards its tip and the pocket floors.
+        Pockets are recognized on every body for every attack vector. Empty by default, which uses the negative z axis.
         """
-        return str()
-    @vendor.setter
-    def vendor(self, value: str):
+        return [float()]
+    @attackVectors.setter
+    def attackVectors(self, value: list[float]):
         """
-        The case-insensitive vendor specifies vendor of the PrintSetting. Generic FFF PrintSetting doesnt have a vendor.
+        Gets and sets the vectors defining the orientations in which to search for pockets, as an array of doubles where they
+        are the x, y, z components of each vector. Each vector points down along the tool towards its tip and the pocket floors.
+        Pockets are recognized on every body for every attack vector. Empty by default, which uses the negative z axis.
         """
         pass
     @property
-    def material(self) -> str:
+    def isRecognizingHoles(self) -> bool:
         """
-        The case-insensitive material specifies material of the MPBF PrintSetting.
+        Gets and sets whether holes are recognized. True by default.
         """
-        return str()
-    @material.setter
-    def material(self, value: str):
+        return bool()
+    @isRecognizingHoles.setter
+    def isRecognizingHoles(self, value: bool):
         """
-        The case-insensitive material specifies material of the MPBF PrintSetting.
+        Gets and sets whether holes are recognized. True by default.
         """
         pass
     @property
-    def layerHeight(self) -> float:
+    def isRecognizingPockets(self) -> bool:
         """
-        The layer height specifies layer height of the PrintSetting. This should match the PrintSetting layer height in cm.
+        Gets and sets whether pockets are recognized. True by default.
         """
-        return float()
-    @layerHeight.setter
-    def layerHeight(self, value: float):
+        return bool()
+    @isRecognizingPockets.setter
+    def isRecognizingPockets(self, value: bool):
         """
-        The layer height specifies layer height of the PrintSetting. This should match the PrintSetting layer height in cm.
+        Gets and sets whether pockets are recognized. True by default.
         """
         pass
     @property
-    def url(self) -> core.URL:
+    def holesInput(self) -> RecognizedHolesInput:
         """
-        The URL specifies the location and folder to search for in the PrintSetting library.
-        Setting the URL updates the location.
+        Gets and sets the settings used to recognize holes. Null by default, which uses the default settings.
         """
-        return core.URL()
-    @url.setter
-    def url(self, value: core.URL):
+        return RecognizedHolesInput()
+    @holesInput.setter
+    def holesInput(self, value: RecognizedHolesInput):
         """
-        The URL specifies the location and folder to search for in the PrintSetting library.
-        Setting the URL updates the location.
+        Gets and sets the settings used to recognize holes. Null by default, which uses the default settings.
         """
         pass
     @property
-    def location(self) -> LibraryLocations:
+    def boundaryTolerance(self) -> float:
         """
-        The location specifies the location to search in the PrintSetting library.
-        Setting the location clears any previous specified URL.
+        Gets and sets the tolerance in centimeters used to approximate the pocket boundaries and islands by polylines. 0.001 by default.
         """
-        return LibraryLocations()
-    @location.setter
-    def location(self, value: LibraryLocations):
+        return float()
+    @boundaryTolerance.setter
+    def boundaryTolerance(self, value: float):
         """
-        The location specifies the location to search in the PrintSetting library.
-        Setting the location clears any previous specified URL.
+        Gets and sets the tolerance in centimeters used to approximate the pocket boundaries and islands by polylines. 0.001 by default.
         """
         pass
     @property
-    def machine(self) -> Machine:
+    def maxConcurrency(self) -> int:
         """
-        The machine specifies which machine the found print setting are compatible with.
+        Gets and sets the maximum number of bodies and attack vectors that are processed at the same time.
+        0 uses the number of processor cores. 0 by default.
         """
-        return Machine()
-    @machine.setter
-    def machine(self, value: Machine):
+        return int()
+    @maxConcurrency.setter
+    def maxConcurrency(self, value: int):
         """
-        The machine specifies which machine the found print setting are compatible with.
+        Gets and sets the maximum number of bodies and attack vectors that are processed at the same time.
+        0 uses the number of processor cores. 0 by default.
         """
         pass
 
@@ -5882,6 +7686,22 @@ class Setups(core.Base):
         The number of setups in the collection.
         """
         return int()
+    def createFromCAMTemplate(self, input: CreateFromCAMTemplateInput, setups: list[Setup]) -> CreateFromCAMTemplateResults:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Creates new operations, folders, or patterns from the template of the input in many setups in one call. They are
+        added to the end of each setup. The template is parsed once and reused for all setups, and the geometry selections
+        of the template are resolved for the setups in parallel. A setup the template cannot be instantiated in does not
+        stop the others. When the generation mode of the input generates the operations, the generation of the operations
+        of all setups is started once they are all created.
+        input : Input object that contains the template to create from, the generation mode and the concurrency.
+        setups : The setups to instantiate the template in.
+        Returns the operations created in each setup and the errors, or null if the template could not be parsed.
+        """
+        return CreateFromCAMTemplateResults()
 
 class SetupVisibilityManager(core.Base):
     """
@@ -5998,6 +7818,237 @@ class StockMaterial(core.Base):
         """
         pass
 
+class StockSimulationInput(core.Base):
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    Defines the operations and the options for a stock simulation.
+    Use the CAM.createStockSimulationInput method to create a new input object and pass it to
+    the CAM.simulateStockRemoval method.
+    The simulation starts from the stock of the parent setup of the first operation, as defined by its stock mode,
+    and removes the material swept by the tool of each operation along its toolpath. The tool shape is taken from
+    the parameters of the tool of the operation. The stock is represented by dexels, parallel lines of material
+    along the tool orientation of the setup, so no user interface or graphics are needed.
+    """
+    def __init__(self):
+        pass
+    @staticmethod
+    def cast(arg) -> StockSimulationInput:
+        return StockSimulationInput()
+    @property
+    def operations(self) -> core.Base:
+        """
+        Returns the Operation, Setup, Folder, or Pattern object or the ObjectCollection of these objects
+        the input was created for.
+        """
+        return core.Base()
+    @property
+    def resolution(self) -> float:
+        """
+        Gets and sets the spacing of the dexels in centimeters. Smaller values give more accurate deviations
+        at the cost of memory and time. 0 by default, which derives the spacing from the smallest tool of the operations.
+        """
+        return float()
+    @resolution.setter
+    def resolution(self, value: float):
+        """
+        Gets and sets the spacing of the dexels in centimeters. Smaller values give more accurate deviations
+        at the cost of memory and time. 0 by default, which derives the spacing from the smallest tool of the operations.
+        """
+        pass
+    @property
+    def gougeTolerance(self) -> float:
+        """
+        Gets and sets the distance in centimeters the tool may cut into the model before a gouge is reported. 0.001 by default.
+        """
+        return float()
+    @gougeTolerance.setter
+    def gougeTolerance(self, value: float):
+        """
+        Gets and sets the distance in centimeters the tool may cut into the model before a gouge is reported. 0.001 by default.
+        """
+        pass
+    @property
+    def holderClearance(self) -> float:
+        """
+        Gets and sets the minimum distance in centimeters between the stock and the tool holder or shank
+        before a collision is reported. 0 by default.
+        """
+        return float()
+    @holderClearance.setter
+    def holderClearance(self, value: float):
+        """
+        Gets and sets the minimum distance in centimeters between the stock and the tool holder or shank
+        before a collision is reported. 0 by default.
+        """
+        pass
+    @property
+    def isDeviationIncluded(self) -> bool:
+        """
+        Gets and sets whether the deviation between the remaining stock and the model is calculated.
+        Leave this off if only the collisions are needed. True by default.
+        """
+        return bool()
+    @isDeviationIncluded.setter
+    def isDeviationIncluded(self, value: bool):
+        """
+        Gets and sets whether the deviation between the remaining stock and the model is calculated.
+        Leave this off if only the collisions are needed. True by default.
+        """
+        pass
+    @property
+    def isStoppingAtFirstCollision(self) -> bool:
+        """
+        Gets and sets whether the simulation stops at the first collision. False by default.
+        """
+        return bool()
+    @isStoppingAtFirstCollision.setter
+    def isStoppingAtFirstCollision(self, value: bool):
+        """
+        Gets and sets whether the simulation stops at the first collision. False by default.
+        """
+        pass
+    @property
+    def maxConcurrency(self) -> int:
+        """
+        Gets and sets the maximum number of threads used by the simulation.
+        0 uses the number of processor cores. 0 by default.
+        """
+        return int()
+    @maxConcurrency.setter
+    def maxConcurrency(self, value: int):
+        """
+        Gets and sets the maximum number of threads used by the simulation.
+        0 uses the number of processor cores. 0 by default.
+        """
+        pass
+
+class StockSimulationResult(core.Base):
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    Object returned when using the simulateStockRemoval method from the CAM class.
+    The deviation of the remaining stock from the model is sampled at points on the model surface.
+    The deviation is positive where stock remains on the model and negative where the model was gouged.
+    Collisions are identified by the index of the operation in the operations array and the index of the move,
+    which is indexed the same way as the points of the ToolpathData of the operation: move i ends at point i.
+    """
+    def __init__(self):
+        pass
+    @staticmethod
+    def cast(arg) -> StockSimulationResult:
+        return StockSimulationResult()
+    @property
+    def operations(self) -> list[OperationBase]:
+        """
+        Gets the operations that were simulated, in machining order.
+        """
+        return [OperationBase()]
+    @property
+    def moveCount(self) -> int:
+        """
+        Gets the total number of moves simulated over all operations.
+        """
+        return int()
+    @property
+    def duration(self) -> float:
+        """
+        Gets the time in seconds spent simulating.
+        """
+        return float()
+    @property
+    def isCompleted(self) -> bool:
+        """
+        Returns false if the simulation stopped at the first collision before all operations were simulated.
+        """
+        return bool()
+    @property
+    def minimumDeviation(self) -> float:
+        """
+        Gets the smallest deviation in centimeters. A negative value is the depth of the deepest gouge.
+        """
+        return float()
+    @property
+    def maximumDeviation(self) -> float:
+        """
+        Gets the largest deviation in centimeters, which is the thickest remaining stock.
+        """
+        return float()
+    @property
+    def deviationCount(self) -> int:
+        """
+        Gets the number of points the deviation is sampled at.
+        """
+        return int()
+    def deviationPositions(self, startIndex: int = 0, count: int = -1) -> list[float]:
+        """
+        Gets the points on the model surface the deviation is sampled at as an array of doubles where they are the x, y, z
+        components of each point. The positions are in centimeters and defined in the world coordinate system of the setup.
+        startIndex : The index of the first point to return.
+        count : The number of points to return. Use -1 to return all points from startIndex to the end.
+        Returns an array of 3 * count values.
+        """
+        return [float()]
+    def deviations(self, startIndex: int = 0, count: int = -1) -> list[float]:
+        """
+        Gets the signed distance in centimeters from each sample point to the remaining stock, measured along the model normal.
+        startIndex : The index of the first point to return.
+        count : The number of points to return. Use -1 to return all points from startIndex to the end.
+        Returns an array of count values.
+        """
+        return [float()]
+    @property
+    def collisionCount(self) -> int:
+        """
+        Gets the number of collisions detected.
+        """
+        return int()
+    def collisionOperationIndices(self, startIndex: int = 0, count: int = -1) -> list[int]:
+        """
+        Gets the index into the operations array of the operation each collision occurred in.
+        startIndex : The index of the first collision to return.
+        count : The number of collisions to return. Use -1 to return all collisions from startIndex to the end.
+        Returns an array of count values.
+        """
+        return [int()]
+    def collisionMoveIndices(self, startIndex: int = 0, count: int = -1) -> list[int]:
+        """
+        Gets the index of the move of the operation each collision occurred at.
+        startIndex : The index of the first collision to return.
+        count : The number of collisions to return. Use -1 to return all collisions from startIndex to the end.
+        Returns an array of count values.
+        """
+        return [int()]
+    def collisionTypes(self, startIndex: int = 0, count: int = -1) -> list[int]:
+        """
+        Gets the type of each collision. The values are obtained from the StockSimulationCollisionTypes enum
+        and returned as integers.
+        startIndex : The index of the first collision to return.
+        count : The number of collisions to return. Use -1 to return all collisions from startIndex to the end.
+        Returns an array of count values.
+        """
+        return [int()]
+    def collisionPositions(self, startIndex: int = 0, count: int = -1) -> list[float]:
+        """
+        Gets the tool tip position at each collision as an array of doubles where they are the x, y, z components of each point.
+        startIndex : The index of the first collision to return.
+        count : The number of collisions to return. Use -1 to return all collisions from startIndex to the end.
+        Returns an array of 3 * count values.
+        """
+        return [float()]
+    def collisionDepths(self, startIndex: int = 0, count: int = -1) -> list[float]:
+        """
+        Gets the largest depth in centimeters the tool, shank or holder penetrates the stock, model or fixture at each collision.
+        startIndex : The index of the first collision to return.
+        count : The number of collisions to return. Use -1 to return all collisions from startIndex to the end.
+        Returns an array of count values.
+        """
+        return [float()]
+
 class Tool(core.Base):
     """
     Represents a Tool.
@@ -6010,49 +8061,174 @@ class Tool(core.Base):
     @staticmethod
     def createFromJson(json: str) -> Tool:
         """
-        Creates a Tool object from given JSON string.
-        json : The JSON should fully define the tool and contain all tool parameters.
-        If the JSON contains more than one tool, only the first Tool is loaded.
-        Returns the newly created Tool.
+        Creates a Tool object from given JSON string.
+        json : The JSON should fully define the tool and contain all tool parameters.
+        If the JSON contains more than one tool, only the first Tool is loaded.
+        Returns the newly created Tool.
+        """
+        return Tool()
+    @staticmethod
+    def createFromP21(p21: str) -> Tool:
+        """
+        Creates a Tool object given a string containing a tool defined using the P21 format.
+        Throws an error if the given string does not conform to the P21 format.
+        p21 : Creates a Tool object from the given P21 string.
+        Returns the newly created Tool.
+        """
+        return Tool()
+    @staticmethod
+    def createFromP21File(filename: str) -> Tool:
+        """
+        Creates a Tool object given a P21 file.
+        Throws an error if the given file is not a valid P21 file.
+        filename : The full filename of the P21 file to use to create the Tool.
+        Returns the newly created Tool.
+        """
+        return Tool()
+    def toJson(self) -> str:
+        """
+        Generates and returns a JSON string that contains a description of this tool.
+        Returns a JSON string that contains a description of this tool.
+        """
+        return str()
+    @property
+    def parameters(self) -> CAMParameters:
+        """
+        Gets the CAMParameters collection associated with this tool. This
+        defines all of the settings that describe the details of the tool.
+        """
+        return CAMParameters()
+    @property
+    def presets(self) -> ToolPresets:
+        """
+        Gets the ToolPresets collection associated with this tool.
+        """
+        return ToolPresets()
+
+class ToolIndex(core.Base):
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    An index of the tools of several tool libraries that answers range and nearest-match queries on the key geometry of
+    the tools without loading the libraries. Each tool is an entry of the index, and the fields of all entries are
+    stored as columns that can be read as arrays. The index is stored in a file and only the libraries whose content
+    has changed since the last update are read again.
+    Use the ToolLibraries.openToolIndex method to get an index.
+    """
+    def __init__(self):
+        pass
+    @staticmethod
+    def cast(arg) -> ToolIndex:
+        return ToolIndex()
+    @property
+    def filePath(self) -> str:
+        """
+        Returns the full path of the file the index is stored in.
+        """
+        return str()
+    def addLibraries(self, location: LibraryLocations) -> bool:
+        """
+        Adds all tool libraries of a location to the index. Libraries added to the location later are picked up by update.
+        location : The location of the libraries to add.
+        Returns true if the location was added successfully.
+        """
+        return bool()
+    def addLibrary(self, url: core.URL) -> bool:
+        """
+        Adds a single tool library to the index.
+        url : The URL of the tool library to add.
+        Returns true if the library was added successfully.
+        """
+        return bool()
+    def update(self) -> int:
+        """
+        Reads the libraries that were added since the last update or whose content has changed, and saves the index to its file.
+        Libraries that are unchanged are not read again. Libraries that no longer exist are removed from the index.
+        Returns the number of libraries that were read, or -1 if the update failed.
+        """
+        return int()
+    def invalidate(self, url: core.URL) -> bool:
+        """
+        Removes the entries of a tool library from the index so they are read again by the next update.
+        url : The URL of the tool library to invalidate.
+        Returns true if the library was part of the index.
+        """
+        return bool()
+    @property
+    def libraryURLs(self) -> list[core.URL]:
+        """
+        Returns the URLs of the tool libraries in the index.
+        """
+        return [core.URL()]
+    @property
+    def entryCount(self) -> int:
+        """
+        Returns the number of tools in the index.
         """
-        return Tool()
-    @staticmethod
-    def createFromP21(p21: str) -> Tool:
+        return int()
+    def fieldValues(self, field: ToolIndexFields, startIndex: int = 0, count: int = -1) -> list[float]:
         """
-        Creates a Tool object given a string containing a tool defined using the P21 format.
-        Throws an error if the given string does not conform to the P21 format.
-        p21 : Creates a Tool object from the given P21 string.
-        Returns the newly created Tool.
+        Returns the values of a field for the entries of the index. Lengths are in centimeters.
+        The value is 0 if the tool does not have the field.
+        field : The field to return.
+        startIndex : The index of the first entry to return.
+        count : The number of entries to return. Use -1 to return all entries from startIndex to the end of the index.
+        Returns an array of count values.
         """
-        return Tool()
-    @staticmethod
-    def createFromP21File(filename: str) -> Tool:
+        return [float()]
+    def holderDescriptions(self, startIndex: int = 0, count: int = -1) -> list[str]:
         """
-        Creates a Tool object given a P21 file.
-        Throws an error if the given file is not a valid P21 file.
-        filename : The full filename of the P21 file to use to create the Tool.
-        Returns the newly created Tool.
+        Returns the description of the holder of each entry, or an empty string if the tool has no holder.
+        startIndex : The index of the first entry to return.
+        count : The number of entries to return. Use -1 to return all entries from startIndex to the end of the index.
+        Returns an array of count values.
         """
-        return Tool()
-    def toJson(self) -> str:
+        return [str()]
+    def libraryIndices(self, startIndex: int = 0, count: int = -1) -> list[int]:
         """
-        Generates and returns a JSON string that contains a description of this tool.
-        Returns a JSON string that contains a description of this tool.
+        Returns the index into the libraryURLs array of the library of each entry.
+        startIndex : The index of the first entry to return.
+        count : The number of entries to return. Use -1 to return all entries from startIndex to the end of the index.
+        Returns an array of count values.
         """
-        return str()
-    @property
-    def parameters(self) -> CAMParameters:
+        return [int()]
+    def toolItemIndices(self, startIndex: int = 0, count: int = -1) -> list[int]:
         """
-        Gets the CAMParameters collection associated with this tool. This
-        defines all of the settings that describe the details of the tool.
+        Returns the index of the tool of each entry inside its ToolLibrary.
+        startIndex : The index of the first entry to return.
+        count : The number of entries to return. Use -1 to return all entries from startIndex to the end of the index.
+        Returns an array of count values.
         """
-        return CAMParameters()
-    @property
-    def presets(self) -> ToolPresets:
+        return [int()]
+    def findInRange(self, fields: list[int], minimumValues: list[float], maximumValues: list[float]) -> list[int]:
         """
-        Gets the ToolPresets collection associated with this tool.
+        Finds the entries whose fields are all inside the specified ranges.
+        fields : The fields to filter by. The values are obtained from the ToolIndexFields enum.
+        minimumValues : The minimum value of each field. The array must have the same size as fields.
+        maximumValues : The maximum value of each field. The array must have the same size as fields.
+        Returns the indices of the matching entries in ascending order.
         """
-        return ToolPresets()
+        return [int()]
+    def findNearest(self, fields: list[int], values: list[float], weights: list[float], maxResults: int = 1) -> list[int]:
+        """
+        Finds the entries closest to the specified values. The distance is the sum of the absolute differences of the fields,
+        each multiplied by its weight.
+        fields : The fields to filter by. The values are obtained from the ToolIndexFields enum.
+        values : The target value of each field. The array must have the same size as fields.
+        weights : The weight of each field. The array must be empty, which weights all fields with 1, or have the same size as fields.
+        maxResults : The maximum number of entries to return.
+        Returns the indices of the closest entries, the closest one first.
+        """
+        return [int()]
+    def entry(self, entryIndex: int) -> ToolQueryResult:
+        """
+        Returns the tool of an entry. The tool library of the entry is only loaded when this method is called.
+        entryIndex : The index of the entry.
+        Returns the result holding the tool and its library, or null if the index is invalid.
+        """
+        return ToolQueryResult()
 
 class ToolLibrary(core.Base):
     """
@@ -6125,6 +8301,184 @@ class ToolLibrary(core.Base):
         """
         return int()
 
+class ToolpathGeneratedEventHandler(core.EventHandler):
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    The ToolpathGeneratedEventHandler is a client implemented class that can be added as a handler to a
+    ToolpathGeneratedEvent.
+    """
+    def __init__(self):
+        pass
+    @staticmethod
+    def cast(arg) -> ToolpathGeneratedEventHandler:
+        return ToolpathGeneratedEventHandler()
+    def notify(self, eventArgs: ToolpathGeneratedEventArgs) -> None:
+        """
+        The function called by CAM when the associated event is fired.
+        eventArgs : Returns an object that provides access to additional information associated with the event.
+        """
+        pass
+
+class ToolpathGenerationInput(core.Base):
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    Defines the operations to generate and how the generation is scheduled.
+    Use the CAM.createToolpathGenerationInput method to create a new input object and pass it to
+    the CAM.generateToolpathWithInput method.
+    Operations that depend on the result of other operations, like rest machining operations or operations
+    using the rest stock of previous operations, are never started before the operations they depend on
+    have been generated, regardless of their priority or the maximum concurrency.
+    """
+    def __init__(self):
+        pass
+    @staticmethod
+    def cast(arg) -> ToolpathGenerationInput:
+        return ToolpathGenerationInput()
+    @property
+    def operations(self) -> core.Base:
+        """
+        Returns the Operation, Setup, Folder, or Pattern object or the ObjectCollection of these objects
+        the input was created for.
+        """
+        return core.Base()
+    @property
+    def maxConcurrency(self) -> int:
+        """
+        Gets and sets the maximum number of operations that are generated at the same time.
+        0 uses the number of parallel generations defined in the preferences. 0 by default.
+        """
+        return int()
+    @maxConcurrency.setter
+    def maxConcurrency(self, value: int):
+        """
+        Gets and sets the maximum number of operations that are generated at the same time.
+        0 uses the number of parallel generations defined in the preferences. 0 by default.
+        """
+        pass
+    @property
+    def isSkippingValidOperations(self) -> bool:
+        """
+        Gets and sets whether operations that are already valid are skipped and only invalid operations are regenerated.
+        False by default.
+        """
+        return bool()
+    @isSkippingValidOperations.setter
+    def isSkippingValidOperations(self, value: bool):
+        """
+        Gets and sets whether operations that are already valid are skipped and only invalid operations are regenerated.
+        False by default.
+        """
+        pass
+    def setPriority(self, operation: OperationBase, priority: int) -> bool:
+        """
+        Sets the priority of an operation. Whenever the generation of another operation can be started,
+        the operation with the highest priority whose dependencies are generated is started first.
+        Operations with the same priority are started in the order they appear in the browser.
+        operation : The operation to set the priority for. It must be one of the operations of this input.
+        priority : The priority of the operation. All operations have a priority of 0 by default.
+        Returns true if the priority was set successfully.
+        """
+        return bool()
+    def priority(self, operation: OperationBase) -> int:
+        """
+        Gets the priority of an operation.
+        operation : The operation to get the priority for.
+        Returns the priority of the operation.
+        """
+        return int()
+
+class ToolpathInvalidationResult(core.Base):
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    Describes whether the toolpath of a single operation is affected by the changes made to the design
+    since the operation was generated and why.
+    """
+    def __init__(self):
+        pass
+    @staticmethod
+    def cast(arg) -> ToolpathInvalidationResult:
+        return ToolpathInvalidationResult()
+    @property
+    def operation(self) -> OperationBase:
+        """
+        Returns the operation this result is for.
+        """
+        return OperationBase()
+    @property
+    def isAffected(self) -> bool:
+        """
+        Returns true if the toolpath of the operation needs to be regenerated because at least one of its inputs has changed.
+        """
+        return bool()
+    @property
+    def reasons(self) -> list[int]:
+        """
+        Returns the reasons why the operation needs to be regenerated. The values are obtained from the
+        ToolpathInvalidationReasons enum and returned as integers. The array is empty if the operation is not affected.
+        """
+        return [int()]
+    @property
+    def changedEntities(self) -> list[core.Base]:
+        """
+        Returns the faces and bodies referenced by the operation whose entity token or revision id differs from the one
+        recorded when the operation was generated. Entities that no longer exist are not included.
+        """
+        return [core.Base()]
+    @property
+    def description(self) -> str:
+        """
+        Returns a readable summary of the reasons, for instance to be written to a log.
+        """
+        return str()
+
+class ToolpathInvalidationResults(core.Base):
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    Collection of ToolpathInvalidationResult objects, one for each operation that was checked.
+    """
+    def __init__(self):
+        pass
+    @staticmethod
+    def cast(arg) -> ToolpathInvalidationResults:
+        return ToolpathInvalidationResults()
+    def __len__(self) -> int:
+        return 0
+    def __getitem__(self, index: int) -> ToolpathInvalidationResult:
+        return None
+    def __iter__(self) -> Iterator[ToolpathInvalidationResult]:
+        return None
+    def item(self, index: int) -> ToolpathInvalidationResult:
+        """
+        Function that returns the specified result using an index into the collection.
+        index : The index of the item within the collection to return. The first item in the collection has an index of 0.
+        Returns the specified item or null if an invalid index was specified.
+        """
+        return ToolpathInvalidationResult()
+    @property
+    def count(self) -> int:
+        """
+        The number of items in the collection.
+        """
+        return int()
+    @property
+    def affectedCount(self) -> int:
+        """
+        Returns the number of operations in the collection that need to be regenerated.
+        """
+        return int()
+
 class ToolPreset(core.Base):
     """
     A Preset defines the material specific properties of a Tool.
@@ -7103,20 +9457,180 @@ class CAM(core.Product):
         """
         Returns the collection of NC programs in the document.
         """
-        return NCPrograms()
+        return NCPrograms()
+    @property
+    def documentStockMaterialLibrary(self) -> DocumentStockMaterialLibrary:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Gets the document StockMaterialLibrary. The StockMaterialLibrary contains all stock materials used by any setup inside the document.
+        Changes to the original StockMaterialLibrary will not affect any setup because the document StockMaterialLibrary is an
+        independent copy.
+        You can only get a valid DocumentStockMaterialLibrary when you have access to Stock Materials private preview feature and enable the feature flag.
+        """
+        return DocumentStockMaterialLibrary()
+    def createToolpathGenerationInput(self, operations: core.Base) -> ToolpathGenerationInput:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Creates a new ToolpathGenerationInput object for the specified objects to be used with the generateToolpathWithInput method.
+        operations : An Operation, Setup, Folder, or Pattern object. You can also use an ObjectCollection
+        to specify multiple objects of any of the supported types.
+        Returns the newly created ToolpathGenerationInput object or null if the creation failed.
+        """
+        return ToolpathGenerationInput()
+    def generateToolpathWithInput(self, input: ToolpathGenerationInput) -> GenerateToolpathFuture:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Generates or regenerates the operations of the input, including those nested in sub-folders or patterns,
+        using the priorities and the maximum concurrency defined by the input.
+        Use the operationGenerated event of the returned future to get notified as soon as each operation is generated.
+        input : The ToolpathGenerationInput object that defines the operations and how they are scheduled.
+        Return GenerateToolpathFuture that includes the status of the operation generation.
+        """
+        return GenerateToolpathFuture()
+    def analyzeToolpathInvalidation(self, operations: core.Base) -> ToolpathInvalidationResults:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Compares the entity tokens of the faces and the revision ids of the bodies referenced by the specified operations,
+        including those nested in sub-folders or patterns, with the ones recorded when the operations were generated.
+        This is a dry run: no operation is invalidated.
+        operations : An Operation, Setup, Folder, or Pattern object. You can also use an ObjectCollection
+        to specify multiple objects of any of the supported types.
+        Returns a collection with one result for each checked operation that reports whether it would be regenerated and why.
+        """
+        return ToolpathInvalidationResults()
+    def invalidateChangedToolpaths(self, operations: core.Base) -> ToolpathInvalidationResults:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Invalidates only those of the specified operations, including those nested in sub-folders or patterns, whose referenced
+        faces, bodies or stock have actually changed, together with the operations depending on them.
+        Unlike checkValidity, operations referencing only unchanged geometry stay valid, so a subsequent call of
+        generateAllToolpaths with skipValid set to true only regenerates the affected operations.
+        operations : An Operation, Setup, Folder, or Pattern object. You can also use an ObjectCollection
+        to specify multiple objects of any of the supported types.
+        Returns a collection with one result for each checked operation that reports whether it was invalidated and why.
+        """
+        return ToolpathInvalidationResults()
+    def createKinematicMachiningTimeInput(self, operations: core.Base) -> KinematicMachiningTimeInput:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Creates a new KinematicMachiningTimeInput object for the specified objects to be used with the getKinematicMachiningTime method.
+        operations : An Operation, Setup, Folder, or Pattern object. You can also use an ObjectCollection
+        to specify multiple objects of any of the supported types.
+        Returns the newly created KinematicMachiningTimeInput object or null if the creation failed.
+        """
+        return KinematicMachiningTimeInput()
+    def getKinematicMachiningTime(self, input: KinematicMachiningTimeInput) -> KinematicMachiningTime:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Get the machining time for the operations of the input, taking the dynamics of the machine axes and the controller into account.
+        The operations have to be generated. Operations are estimated in parallel.
+        input : The KinematicMachiningTimeInput object that defines the operations and the options of the estimate.
+        Returns a KinematicMachiningTime object that has properties holding the calculation results.
+        """
+        return KinematicMachiningTime()
+    def createStockSimulationInput(self, operations: core.Base) -> StockSimulationInput:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Creates a new StockSimulationInput object for the specified objects to be used with the simulateStockRemoval method.
+        operations : An Operation, Setup, Folder, or Pattern object. You can also use an ObjectCollection
+        to specify multiple objects of any of the supported types. All operations must belong to the same setup.
+        Returns the newly created StockSimulationInput object or null if the creation failed.
+        """
+        return StockSimulationInput()
+    def simulateStockRemoval(self, input: StockSimulationInput) -> StockSimulationResult:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Simulates the material removal of the operations of the input without displaying the simulation.
+        The operations have to be generated. The tool sweeps are applied to the stock in parallel.
+        input : The StockSimulationInput object that defines the operations and the options of the simulation.
+        Returns a StockSimulationResult object holding the deviations and the collisions, or null if the simulation failed.
+        """
+        return StockSimulationResult()
+    @property
+    def batchedChanged(self) -> CAMBatchedChangeEvent:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        The batchedChanged event fires with the coalesced list of the operation changes raised by CAMEventManager.operationBaseChanged
+        and the setup changes raised by setupChanged, for handlers that do not need to be notified of every single change,
+        for instance while a template is applied or parameters are swept. Changes are collected only while a handler is added
+        to the event, and the operationBaseChanged and setupChanged events still fire for their own handlers.
+        """
+        return CAMBatchedChangeEvent()
+    @property
+    def batchedChangeInterval(self) -> float:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Gets and sets the time in seconds between two deliveries of the batchedChanged event. Changes raised during the interval
+        are delivered together at its end. 0 delivers the changes only when the command or transaction that raised them ends.
+        Defaults to 0.
+        """
+        return float()
+    @batchedChangeInterval.setter
+    def batchedChangeInterval(self, value: float):
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Gets and sets the time in seconds between two deliveries of the batchedChanged event. Changes raised during the interval
+        are delivered together at its end. 0 delivers the changes only when the command or transaction that raised them ends.
+        Defaults to 0.
+        """
+        pass
+    @property
+    def changeEventsRaisedCount(self) -> int:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Returns the number of operationBaseChanged and setupChanged events raised since the document was opened.
+        """
+        return int()
     @property
-    def documentStockMaterialLibrary(self) -> DocumentStockMaterialLibrary:
+    def changeEventsDeliveredCount(self) -> int:
         """
         !!!!! Warning !!!!!
         ! This is in preview state; please see the help for more info
         !!!!! Warning !!!!!
         
-        Gets the document StockMaterialLibrary. The StockMaterialLibrary contains all stock materials used by any setup inside the document.
-        Changes to the original StockMaterialLibrary will not affect any setup because the document StockMaterialLibrary is an
-        independent copy.
-        You can only get a valid DocumentStockMaterialLibrary when you have access to Stock Materials private preview feature and enable the feature flag.
+        Returns the number of coalesced changes delivered by the batchedChanged event since the document was opened.
+        Comparing it with changeEventsRaisedCount shows how many notifications were saved by batching.
         """
-        return DocumentStockMaterialLibrary()
+        return int()
 
 class CAM3MFExportOptions(CAMExportOptions):
     """
@@ -7261,6 +9775,100 @@ class CAM3MFExportOptions(CAMExportOptions):
         The default value is 128.
         """
         pass
+    @property
+    def isStreamed(self) -> bool:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Flag toggling if the 3MF package is written to the file while it is generated. Meshes and volumetric data slices are
+        compressed and written as soon as they are available instead of building the whole package in memory first,
+        which keeps the memory used by large builds with volumetric data bounded by maxBufferSize.
+        The default value is false.
+        """
+        return bool()
+    @isStreamed.setter
+    def isStreamed(self, value: bool):
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Flag toggling if the 3MF package is written to the file while it is generated. Meshes and volumetric data slices are
+        compressed and written as soon as they are available instead of building the whole package in memory first,
+        which keeps the memory used by large builds with volumetric data bounded by maxBufferSize.
+        The default value is false.
+        """
+        pass
+    @property
+    def maxBufferSize(self) -> int:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Integer value representing the maximum amount of memory in megabytes used to buffer parts of the package that are not
+        yet written when isStreamed is true. Generating further parts waits while the buffer is full.
+        The default value is 256.
+        """
+        return int()
+    @maxBufferSize.setter
+    def maxBufferSize(self, value: int):
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Integer value representing the maximum amount of memory in megabytes used to buffer parts of the package that are not
+        yet written when isStreamed is true. Generating further parts waits while the buffer is full.
+        The default value is 256.
+        """
+        pass
+    @property
+    def compressionLevel(self) -> int:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Integer value from 0 to 9 representing the deflate compression level of the parts of the package, where 0 stores
+        the parts uncompressed and 9 gives the smallest file. The default value is 6.
+        """
+        return int()
+    @compressionLevel.setter
+    def compressionLevel(self, value: int):
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Integer value from 0 to 9 representing the deflate compression level of the parts of the package, where 0 stores
+        the parts uncompressed and 9 gives the smallest file. The default value is 6.
+        """
+        pass
+    @property
+    def maxConcurrency(self) -> int:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Integer value representing the maximum number of parts of the package that are compressed at the same time.
+        0 uses the number of processor cores. The default value is 0.
+        """
+        return int()
+    @maxConcurrency.setter
+    def maxConcurrency(self, value: int):
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Integer value representing the maximum number of parts of the package that are compressed at the same time.
+        0 uses the number of processor cores. The default value is 0.
+        """
+        pass
 
 class CAMAdditiveBuildExportOptions(CAMExportOptions):
     """
@@ -7340,6 +9948,94 @@ class CAMArrangeParameterValue(ParameterValue):
         """
         pass
 
+class CAMBatchedChangeEvent(core.Event):
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    A CAMBatchedChangeEvent delivers the operation and setup changes of a period of time as a single list.
+    It is used by the CAM.batchedChanged event.
+    """
+    def __init__(self):
+        pass
+    @staticmethod
+    def cast(arg) -> CAMBatchedChangeEvent:
+        return CAMBatchedChangeEvent()
+    def add(self, handler: CAMBatchedChangeEventHandler) -> bool:
+        """
+        Add a handler to be notified when the event occurs.
+        handler : The handler object to be called when this event is fired.
+        Returns true if the addition of the handler was successful.
+        """
+        return bool()
+    def remove(self, handler: CAMBatchedChangeEventHandler) -> bool:
+        """
+        Removes a handler from the event.
+        handler : The handler object to be removed from the event.
+        Returns true if removal of the handler was successful.
+        """
+        return bool()
+
+class CAMBatchedChangeEventArgs(core.EventArgs):
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    The CAMBatchedChangeEventArgs provides the coalesced operation and setup changes of a batch.
+    A change is listed once per operation id and change type, or once per setup and change type, however often it was
+    raised during the batch. Changes are listed in the order they were first raised.
+    """
+    def __init__(self):
+        pass
+    @staticmethod
+    def cast(arg) -> CAMBatchedChangeEventArgs:
+        return CAMBatchedChangeEventArgs()
+    @property
+    def operationIds(self) -> list[int]:
+        """
+        Returns the id of the operation of each change. The array has one entry for each coalesced operation change.
+        """
+        return [int()]
+    @property
+    def operations(self) -> list[OperationBase]:
+        """
+        Returns the operation of each change, or null for an operation that has been deleted since the change. The array has one entry for each coalesced operation change.
+        """
+        return [OperationBase()]
+    @property
+    def operationChangeTypes(self) -> list[int]:
+        """
+        Returns the type of each operation change. The values are obtained from the CAMEventChangeType enum and returned as integers. The array has one entry for each coalesced operation change.
+        """
+        return [int()]
+    @property
+    def setups(self) -> list[Setup]:
+        """
+        Returns the setup of each change. The array has one entry for each coalesced setup change.
+        """
+        return [Setup()]
+    @property
+    def setupChangeTypes(self) -> list[int]:
+        """
+        Returns the type of each setup change. The values are obtained from the SetupChangeEventType enum and returned as integers. The array has one entry for each coalesced setup change.
+        """
+        return [int()]
+    @property
+    def raisedCount(self) -> int:
+        """
+        Returns the number of operationBaseChanged and setupChanged events coalesced into this batch.
+        """
+        return int()
+    @property
+    def isTransactionEnd(self) -> bool:
+        """
+        Returns true if the batch is delivered because a command or transaction ended, false if it is delivered because
+        batchedChangeInterval elapsed.
+        """
+        return bool()
+
 class CAMFolder(OperationBase):
     """
     Object that represents a folder in an existing Setup, Folder or Pattern.
@@ -7640,6 +10336,30 @@ class ControllerConfigurationMachineElement(MachineElement):
         Tool Tip adjusts the linear axes to keep the tool's tip positioned along the direct line between the start and finish points.
         """
         pass
+    @property
+    def lookAheadBlockCount(self) -> int:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Number of blocks the controller plans ahead to blend the feedrate over consecutive moves.
+        0 means the count is unknown and the default of the controller is used. 1 means no blending: every move ends at a full stop.
+        By default the value is 0.
+        """
+        return int()
+    @lookAheadBlockCount.setter
+    def lookAheadBlockCount(self, value: int):
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Number of blocks the controller plans ahead to blend the feedrate over consecutive moves.
+        0 means the count is unknown and the default of the controller is used. 1 means no blending: every move ends at a full stop.
+        By default the value is 0.
+        """
+        pass
 
 class CurveSelection(GeometrySelection):
     """
@@ -8715,6 +11435,29 @@ class OptimizedOrientationResults(GeneratedData):
         The number of items in the collection.
         """
         return int()
+    def createScoringInput(self) -> OrientationScoringInput:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Creates a new OrientationScoringInput object with the settings of the parent orientation operation
+        to be used with the scoreOrientations method.
+        Returns the newly created input object.
+        """
+        return OrientationScoringInput()
+    def scoreOrientations(self, input: OrientationScoringInput) -> OrientationScores:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Scores many candidate orientations of the part of the parent orientation operation. The part is tessellated once and
+        the orientations are scored in parallel.
+        input : The OrientationScoringInput object that defines the orientations and the weights.
+        Returns the scores or null if the scoring failed.
+        """
+        return OrientationScores()
 
 class PostLibrary(CAMLibrary):
     """
@@ -9474,6 +12217,195 @@ class ToolLibraries(CAMLibrary):
         Returns a new ToolQuery. The query is predefined by given parameter.
         """
         return ToolQuery()
+    def openToolIndex(self, filePath: str) -> ToolIndex:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Opens the tool index stored in the specified file, or creates a new empty index if the file does not exist.
+        Call ToolIndex.update to bring the index up to date with its libraries.
+        filePath : The full path of the index file. If empty, the default index file in the user's cache folder is used.
+        Returns the tool index or null if the file could not be opened.
+        """
+        return ToolIndex()
+
+class ToolpathData(GeneratedData):
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    The toolpath of a generated operation, exposed as flat arrays instead of individual objects.
+    Every point of the toolpath has a position, a tool axis, a feedrate and a move type, each available
+    as its own contiguous array. Consecutive points are grouped into segments that describe whether the
+    points are connected by lines or arcs.
+    All arrays can be read in chunks by specifying a start index and a count, which avoids copying the
+    whole toolpath at once for very large toolpaths.
+    Use OperationBase.generatedDataCollection.itemByIdentifier with ToolpathGeneratedDataType to get this object.
+    """
+    def __init__(self):
+        pass
+    @staticmethod
+    def cast(arg) -> ToolpathData:
+        return ToolpathData()
+    @property
+    def pointCount(self) -> int:
+        """
+        Returns the total number of points in the toolpath.
+        """
+        return int()
+    @property
+    def segmentCount(self) -> int:
+        """
+        Returns the total number of segments in the toolpath.
+        """
+        return int()
+    def positions(self, startIndex: int = 0, count: int = -1) -> list[float]:
+        """
+        Returns the tool tip positions as an array of doubles where they are the x, y, z components of each point.
+        The positions are in centimeters and defined in the world coordinate system of the setup.
+        startIndex : The index of the first point to return.
+        count : The number of points to return. Use -1 to return all points from startIndex to the end of the toolpath.
+        Returns an array of 3 * count values.
+        """
+        return [float()]
+    def toolAxes(self, startIndex: int = 0, count: int = -1) -> list[float]:
+        """
+        Returns the tool axis at each point as an array of doubles where they are the x, y, z components of each unit vector.
+        For 3-axis toolpaths every vector is equal to the tool orientation of the setup.
+        startIndex : The index of the first point to return.
+        count : The number of points to return. Use -1 to return all points from startIndex to the end of the toolpath.
+        Returns an array of 3 * count values.
+        """
+        return [float()]
+    def feedrates(self, startIndex: int = 0, count: int = -1) -> list[float]:
+        """
+        Returns the feedrate used to move to each point in centimeters per second.
+        The value is -1 for rapid moves, where the feedrate is defined by the machine.
+        startIndex : The index of the first point to return.
+        count : The number of points to return. Use -1 to return all points from startIndex to the end of the toolpath.
+        Returns an array of count values.
+        """
+        return [float()]
+    def moveTypes(self, startIndex: int = 0, count: int = -1) -> list[int]:
+        """
+        Returns the type of the move to each point. The values are obtained from the ToolpathMoveTypes enum
+        and returned as integers.
+        startIndex : The index of the first point to return.
+        count : The number of points to return. Use -1 to return all points from startIndex to the end of the toolpath.
+        Returns an array of count values.
+        """
+        return [int()]
+    def segmentStartIndices(self, startIndex: int = 0, count: int = -1) -> list[int]:
+        """
+        Returns the index of the first point of each segment. A segment ends at the point before the start of the next segment.
+        startIndex : The index of the first segment to return.
+        count : The number of segments to return. Use -1 to return all segments from startIndex to the end of the toolpath.
+        Returns an array of count values.
+        """
+        return [int()]
+    def segmentTypes(self, startIndex: int = 0, count: int = -1) -> list[int]:
+        """
+        Returns the type of each segment. The values are obtained from the ToolpathSegmentTypes enum
+        and returned as integers.
+        startIndex : The index of the first segment to return.
+        count : The number of segments to return. Use -1 to return all segments from startIndex to the end of the toolpath.
+        Returns an array of count values.
+        """
+        return [int()]
+    def arcCenters(self, startIndex: int = 0, count: int = -1) -> list[float]:
+        """
+        Returns the center point of each segment as an array of doubles where they are the x, y, z components of each point.
+        The value is only meaningful for circular and helical segments and is zero for linear segments.
+        startIndex : The index of the first segment to return.
+        count : The number of segments to return. Use -1 to return all segments from startIndex to the end of the toolpath.
+        Returns an array of 3 * count values.
+        """
+        return [float()]
+    def arcNormals(self, startIndex: int = 0, count: int = -1) -> list[float]:
+        """
+        Returns the normal of the arc plane of each segment as an array of doubles where they are the x, y, z components of each vector.
+        The arc runs counter-clockwise around the normal. The value is only meaningful for circular and helical segments
+        and is zero for linear segments.
+        startIndex : The index of the first segment to return.
+        count : The number of segments to return. Use -1 to return all segments from startIndex to the end of the toolpath.
+        Returns an array of 3 * count values.
+        """
+        return [float()]
+
+class ToolpathGeneratedEvent(core.Event):
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    A ToolpathGeneratedEvent represents the completion of the generation of a single operation.
+    It is used by the GenerateToolpathFuture.operationGenerated event.
+    """
+    def __init__(self):
+        pass
+    @staticmethod
+    def cast(arg) -> ToolpathGeneratedEvent:
+        return ToolpathGeneratedEvent()
+    def add(self, handler: ToolpathGeneratedEventHandler) -> bool:
+        """
+        Add a handler to be notified when the event occurs.
+        handler : The handler object to be called when this event is fired.
+        Returns true if the addition of the handler was successful.
+        """
+        return bool()
+    def remove(self, handler: ToolpathGeneratedEventHandler) -> bool:
+        """
+        Removes a handler from the event.
+        handler : The handler object to be removed from the event.
+        Returns true if removal of the handler was successful.
+        """
+        return bool()
+
+class ToolpathGeneratedEventArgs(core.EventArgs):
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    The ToolpathGeneratedEventArgs provides information about an operation whose generation has finished.
+    """
+    def __init__(self):
+        pass
+    @staticmethod
+    def cast(arg) -> ToolpathGeneratedEventArgs:
+        return ToolpathGeneratedEventArgs()
+    @property
+    def operation(self) -> OperationBase:
+        """
+        Returns the operation whose generation has finished.
+        """
+        return OperationBase()
+    @property
+    def duration(self) -> float:
+        """
+        Returns the time in seconds that was spent generating the operation.
+        """
+        return float()
+    @property
+    def isSuccess(self) -> bool:
+        """
+        Returns true if the toolpath was generated without errors.
+        """
+        return bool()
+    @property
+    def error(self) -> str:
+        """
+        Returns the error message if the generation failed, or an empty string otherwise.
+        """
+        return str()
+    @property
+    def numberOfCompleted(self) -> int:
+        """
+        Returns the number of operations of the generation whose generation is complete, including this one.
+        """
+        return int()
 
 class CAMPattern(CAMFolder):
     """
@@ -6,6 +6,33 @@ from collections.abc import Iterator
 
 from . import core
 
+class Arrange3DRotationTypes():
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    Defines the rotations allowed for the parts of a 3D arrangement.
+    """
+    def __init__(self):
+        pass
+    NoneArrange3DRotationType = 0
+    BuildAxisArrange3DRotationType = 1
+    AxisAlignedArrange3DRotationType = 2
+
+class Arrange3DShapeTypes():
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    Defines how the shape of the parts is approximated by a 3D arrangement.
+    """
+    def __init__(self):
+        pass
+    BoundingBoxArrange3DShapeType = 0
+    VoxelArrange3DShapeType = 1
+
 class ArrangePriorities():
     """
     Defines the different types of arrange priorities that are supported.
@@ -236,6 +263,21 @@ class CoilFeatureTypes():
     HeightAndPitchCoilFeatureType = 2
     SpiralCoilFeatureType = 3
 
+class ConfigurationCellValueTypes():
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    The types of the values of the cells of a configuration table as reported by ConfigurationTableData.
+    """
+    def __init__(self):
+        pass
+    StringConfigurationCellValueType = 0
+    DoubleConfigurationCellValueType = 1
+    BooleanConfigurationCellValueType = 2
+    EnumConfigurationCellValueType = 3
+
 class ConfigurationClearanceHoleColumns():
     """
     Enum that defines the valid combinations of clearance hole columns that can be configured.
@@ -1679,6 +1721,59 @@ class AreaProperties(core.Base):
         """
         return CalculationAccuracy()
 
+class Arrange3DPackingResult(core.Base):
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    The result of computing a 3D arrangement with ArrangeFeatures.compute3DArrangement.
+    The arrangement is not applied to the model. Apply the transforms to the occurrences, or pass the same input
+    to ArrangeFeatures.add to create the arrange feature.
+    """
+    def __init__(self):
+        pass
+    @staticmethod
+    def cast(arg) -> Arrange3DPackingResult:
+        return Arrange3DPackingResult()
+    @property
+    def occurrences(self) -> list[Occurrence]:
+        """
+        Returns the occurrence of each placed part. An occurrence is returned several times if its quantity is more than one.
+        """
+        return [Occurrence()]
+    @property
+    def transforms(self) -> list[core.Matrix3D]:
+        """
+        Returns the transform of each placed part, relative to the current position of its occurrence.
+        The array has the same size and order as occurrences.
+        """
+        return [core.Matrix3D()]
+    @property
+    def unplacedOccurrences(self) -> list[Occurrence]:
+        """
+        Returns the occurrences of the parts that did not fit into the envelope, once for each part that was not placed.
+        """
+        return [Occurrence()]
+    @property
+    def packingDensity(self) -> float:
+        """
+        Returns the volume of the placed parts divided by the volume of the envelope up to the top of the highest part, from 0 to 1.
+        """
+        return float()
+    @property
+    def usedHeight(self) -> float:
+        """
+        Returns the height in centimeters from the bottom of the envelope to the top of the highest part.
+        """
+        return float()
+    @property
+    def duration(self) -> float:
+        """
+        Returns the time in seconds spent computing the arrangement.
+        """
+        return float()
+
 class ArrangeComponent(core.Base):
     """
     Defines a component within an arrangement. This specifies an occurrence along with additional
@@ -2297,6 +2392,19 @@ class ArrangeFeatures(core.Base):
         Returns the number of Arrange features in the component.
         """
         return int()
+    def compute3DArrangement(self, input: ArrangeFeatureInput) -> Arrange3DPackingResult:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Computes a 3D arrangement without creating an arrange feature or moving any occurrence, for instance to compare
+        the packing density of different settings. Parts are placed in parallel and the placement is then improved for the
+        searchTimeLimit of the definition.
+        input : An ArrangeFeatureInput created with Arrange3DSolverType that defines the parts, the envelope and the settings.
+        Returns the computed arrangement or null if it could not be computed.
+        """
+        return Arrange3DPackingResult()
 
 class ArrangeOccurrenceResult(core.Base):
     """
@@ -9207,6 +9315,32 @@ class ConfigurationRows(core.Base):
         Returns the number of rows in the table where the header row is not included.
         """
         return int()
+    def generateRows(self, rows: list[ConfigurationRow], maxConcurrency: int = 0, isUsingCache: bool = True) -> ConfigurationBatchFuture:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Generates several rows of the table. Rows are generated at the same time where the model allows it.
+        When isUsingCache is true, a row is skipped if it was generated before with the same cell values and the same
+        version of the design. The cache is keyed by the id of the row, a hash of its cell values and the revision of the design.
+        rows : The rows to generate. The rows must belong to this table.
+        maxConcurrency : The maximum number of rows generated at the same time. 0 uses the number of processor cores.
+        isUsingCache : Specifies whether rows whose inputs have not changed since their last generation are skipped.
+        Returns a future that can be used to follow the generation of each row.
+        Null is returned in the case where starting the generation fails.
+        """
+        return ConfigurationBatchFuture()
+    def clearGenerationCache(self) -> bool:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Clears the cache used by generateRows so the next generation of each row is not skipped.
+        Returns true if the cache was cleared.
+        """
+        return bool()
 
 class ConfigurationSheetMetalRuleColumns(core.Base):
     """
@@ -9282,6 +9416,242 @@ class ConfigurationTable(core.Base):
         Returns the rows (configurations) defined for this table and provides the functionality to create new rows.
         """
         return ConfigurationRows()
+    def exportData(self) -> ConfigurationTableData:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Copies the ids, names and cell values of all columns and rows of this table in a single call.
+        Returns the table data or null in the case of failure.
+        """
+        return ConfigurationTableData()
+    def compareData(self, data: ConfigurationTableData) -> ConfigurationTableDifference:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Compares table data, typically exported from this table and edited, with the current content of this table.
+        data : The table data to compare with. The data must have been exported from this table.
+        Returns the minimal cell, row and name changes needed to make the table match the data, or null in the case of failure.
+        """
+        return ConfigurationTableDifference()
+    def importData(self, data: ConfigurationTableData) -> bool:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Applies table data to this table as a single transaction: only the cells, rows and names reported by compareData are
+        changed, and all changes are undone together. If a change fails, no change is applied. If the table was obtained from
+        a DataFile, this method will fail.
+        data : The table data to apply. The data must have been exported from this table.
+        Returns true if the data was applied successfully.
+        """
+        return bool()
+
+class ConfigurationTableData(core.Base):
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    A copy of the whole content of a configuration table, taken with a single call of ConfigurationTable.exportData.
+    The cells are available as a matrix of typed values instead of one object per cell. The data can be edited and
+    applied back to the table with ConfigurationTable.importData, or compared with the table using ConfigurationTable.compareData.
+    The data is not updated when the table changes afterwards.
+    """
+    def __init__(self):
+        pass
+    @staticmethod
+    def cast(arg) -> ConfigurationTableData:
+        return ConfigurationTableData()
+    @property
+    def tableId(self) -> str:
+        """
+        Returns the id of the table the data was exported from.
+        """
+        return str()
+    @property
+    def columnCount(self) -> int:
+        """
+        Returns the number of columns, not including the name column.
+        """
+        return int()
+    @property
+    def columnIds(self) -> list[str]:
+        """
+        Returns the id of each column.
+        """
+        return [str()]
+    @property
+    def columnTitles(self) -> list[str]:
+        """
+        Returns the title of each column.
+        """
+        return [str()]
+    @property
+    def columnTypes(self) -> list[str]:
+        """
+        Returns the type of each column as the class type of the column object, for example
+        "adsk::fusion::ConfigurationParameterColumn".
+        """
+        return [str()]
+    @property
+    def rowCount(self) -> int:
+        """
+        Returns the number of rows, not including the header row.
+        """
+        return int()
+    @property
+    def rowIds(self) -> list[str]:
+        """
+        Returns the id of each row. Rows added with addRow have an empty id until the data is imported.
+        """
+        return [str()]
+    @property
+    def rowNames(self) -> list[str]:
+        """
+        Gets and sets the name of each row. When setting, the array must have rowCount entries.
+        """
+        return [str()]
+    @rowNames.setter
+    def rowNames(self, value: list[str]):
+        """
+        Gets and sets the name of each row. When setting, the array must have rowCount entries.
+        """
+        pass
+    def valueTypes(self, startIndex: int = 0, count: int = -1) -> list[int]:
+        """
+        Returns the type of the value of each cell. The values are obtained from the ConfigurationCellValueTypes enum and
+        returned as integers. The cells are ordered row by row. Parameter cells have their expression as the string value and their value in
+        internal units as the numeric value.
+        startIndex : The index of the first cell to return, where cell i is in row i / columnCount and column i % columnCount.
+        count : The number of cells to return. Use -1 to return all cells from startIndex to the end of the table.
+        Returns an array of count values.
+        """
+        return [int()]
+    def stringValues(self, startIndex: int = 0, count: int = -1) -> list[str]:
+        """
+        Returns the string value of each cell: the text of string cells, the expression of parameter cells and the id of the
+        selected choice of enum cells. The entry is empty for boolean cells.
+        startIndex : The index of the first cell to return, where cell i is in row i / columnCount and column i % columnCount.
+        count : The number of cells to return. Use -1 to return all cells from startIndex to the end of the table.
+        Returns an array of count values.
+        """
+        return [str()]
+    def numericValues(self, startIndex: int = 0, count: int = -1) -> list[float]:
+        """
+        Returns the numeric value of each cell: the value of double cells in internal units, and 1 for true and 0 for false
+        for boolean cells. The entry is 0 for string and enum cells.
+        startIndex : The index of the first cell to return, where cell i is in row i / columnCount and column i % columnCount.
+        count : The number of cells to return. Use -1 to return all cells from startIndex to the end of the table.
+        Returns an array of count values.
+        """
+        return [float()]
+    def setCells(self, rowIndices: list[int], columnIndices: list[int], stringValues: list[str], numericValues: list[float]) -> bool:
+        """
+        Sets the values of many cells. For string and enum cells, the string value is used. For double cells, the string value
+        is used as the expression if it is not empty, and the numeric value otherwise. For boolean cells, the numeric value is used.
+        rowIndices : The row of each cell to set.
+        columnIndices : The column of each cell to set. The array must have the same size as rowIndices.
+        stringValues : The string value of each cell. The array must have the same size as rowIndices.
+        numericValues : The numeric value of each cell. The array must have the same size as rowIndices.
+        Returns true if all cells were set. No cell is set if an index is invalid or the arrays differ in size.
+        """
+        return bool()
+    def addRow(self, name: str, sourceRowIndex: int) -> int:
+        """
+        Adds a row at the end of the data with the cell values of an existing row.
+        name : The name of the new row.
+        sourceRowIndex : The index of the row whose cell values are copied.
+        Returns the index of the new row or -1 if the source row index is invalid.
+        """
+        return int()
+    def removeRow(self, rowIndex: int) -> bool:
+        """
+        Removes a row from the data. The row is deleted from the table when the data is imported.
+        rowIndex : The index of the row to remove.
+        Returns true if the row was removed.
+        """
+        return bool()
+
+class ConfigurationTableDifference(core.Base):
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    The minimal changes needed to make a configuration table match a ConfigurationTableData, as returned by
+    ConfigurationTable.compareData. Rows are matched by id and columns by id.
+    """
+    def __init__(self):
+        pass
+    @staticmethod
+    def cast(arg) -> ConfigurationTableDifference:
+        return ConfigurationTableDifference()
+    @property
+    def isEqual(self) -> bool:
+        """
+        Returns true if applying the data would not change the table.
+        """
+        return bool()
+    @property
+    def addedRowIndices(self) -> list[int]:
+        """
+        Returns the indices in the data of the rows that do not exist in the table.
+        """
+        return [int()]
+    @property
+    def removedRowIds(self) -> list[str]:
+        """
+        Returns the ids of the rows that were removed from the data using removeRow and still exist in the table. Rows added
+        to the table after the data was exported are not reported and are kept when the data is imported.
+        """
+        return [str()]
+    @property
+    def renamedRowIndices(self) -> list[int]:
+        """
+        Returns the indices in the data of the rows whose name differs from the table.
+        """
+        return [int()]
+    @property
+    def rowIndices(self) -> list[int]:
+        """
+        Returns the row in the data of each changed cell. The array has one entry for each changed cell.
+        """
+        return [int()]
+    @property
+    def columnIndices(self) -> list[int]:
+        """
+        Returns the column in the data of each changed cell. The array has one entry for each changed cell.
+        """
+        return [int()]
+    @property
+    def oldStringValues(self) -> list[str]:
+        """
+        Returns the string value in the table of each changed cell. The array has one entry for each changed cell.
+        """
+        return [str()]
+    @property
+    def newStringValues(self) -> list[str]:
+        """
+        Returns the string value in the data of each changed cell. The array has one entry for each changed cell.
+        """
+        return [str()]
+    @property
+    def oldNumericValues(self) -> list[float]:
+        """
+        Returns the numeric value in the table of each changed cell. The array has one entry for each changed cell.
+        """
+        return [float()]
+    @property
+    def newNumericValues(self) -> list[float]:
+        """
+        Returns the numeric value in the data of each changed cell. The array has one entry for each changed cell.
+        """
+        return [float()]
 
 class ConstructionAxes(core.Base):
     """
@@ -12994,6 +13364,28 @@ class ExportManager(core.Base):
         The created DXFSketchExportOptions object or null if the creation failed.
         """
         return DXFSketchExportOptions()
+    def executeAsync(self, exportOptions: ExportOptions) -> ExportFuture:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Starts an export in the background and returns immediately. Use the returned future to follow the progress of the
+        export or to cancel it.
+        exportOptions : The export options that define the export, created with one of the create methods of the ExportManager.
+        Returns the future of the export or null if the export could not be started.
+        """
+        return ExportFuture()
+    def createExportQueue(self) -> ExportQueue:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Creates an empty queue to run many exports in the background.
+        Returns the newly created export queue.
+        """
+        return ExportQueue()
 
 class ExportOptions(core.Base):
     """
@@ -13035,6 +13427,112 @@ class ExportOptions(core.Base):
         """
         pass
 
+class ExportQueue(core.Base):
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    Runs many exports in the background with a bounded number of exports at the same time.
+    Use the ExportManager.createExportQueue method to create a queue, add the export options with add and call start.
+    Mesh exports (STL, OBJ and 3MF) of the same geometry with the same refinement settings share a single tessellation,
+    and files are written by background threads while the next exports are prepared.
+    """
+    def __init__(self):
+        pass
+    @staticmethod
+    def cast(arg) -> ExportQueue:
+        return ExportQueue()
+    def add(self, exportOptions: ExportOptions) -> ExportFuture:
+        """
+        Adds an export to the queue. Exports are started in the order they are added.
+        exportOptions : The export options that define the export, created with one of the create methods of the ExportManager.
+        Returns the future of the export or null if the export options are invalid.
+        """
+        return ExportFuture()
+    @property
+    def maxConcurrency(self) -> int:
+        """
+        Gets and sets the maximum number of exports running at the same time. 0 uses the number of processor cores.
+        Defaults to 0. It cannot be changed once the queue is started.
+        """
+        return int()
+    @maxConcurrency.setter
+    def maxConcurrency(self, value: int):
+        """
+        Gets and sets the maximum number of exports running at the same time. 0 uses the number of processor cores.
+        Defaults to 0. It cannot be changed once the queue is started.
+        """
+        pass
+    @property
+    def isSharingTessellation(self) -> bool:
+        """
+        Gets and sets whether mesh exports of the same geometry with the same refinement settings share a single tessellation.
+        Defaults to true. It cannot be changed once the queue is started.
+        """
+        return bool()
+    @isSharingTessellation.setter
+    def isSharingTessellation(self, value: bool):
+        """
+        Gets and sets whether mesh exports of the same geometry with the same refinement settings share a single tessellation.
+        Defaults to true. It cannot be changed once the queue is started.
+        """
+        pass
+    def start(self) -> bool:
+        """
+        Starts running the exports of the queue in the background. Exports added afterwards are started as soon as possible.
+        Returns true if the queue was started.
+        """
+        return bool()
+    def cancel(self) -> bool:
+        """
+        Cancels all exports of the queue that are not finished yet.
+        Returns true if the exports were cancelled.
+        """
+        return bool()
+    @property
+    def futures(self) -> list[ExportFuture]:
+        """
+        Returns the futures of all exports of the queue, in the order they were added.
+        """
+        return [ExportFuture()]
+    @property
+    def numberOfCompleted(self) -> int:
+        """
+        Returns the number of exports that are finished, failed or cancelled.
+        """
+        return int()
+    @property
+    def isCompleted(self) -> bool:
+        """
+        Returns true if all exports of the queue are finished, failed or cancelled.
+        """
+        return bool()
+    @property
+    def formatNames(self) -> list[str]:
+        """
+        Returns the formats exported by the queue, as the class type of their export options, for example "adsk::fusion::STLExportOptions".
+        """
+        return [str()]
+    @property
+    def formatFileCounts(self) -> list[int]:
+        """
+        Returns the number of files written for each format. The array has one entry for each format, in the same order as formatNames.
+        """
+        return [int()]
+    @property
+    def formatBytesWritten(self) -> list[int]:
+        """
+        Returns the number of bytes written for each format. The array has one entry for each format, in the same order as formatNames.
+        """
+        return [int()]
+    @property
+    def formatDurations(self) -> list[float]:
+        """
+        Returns the time in seconds spent on the exports of each format. The array has one entry for each format, in the same order as formatNames.
+        """
+        return [float()]
+
 class ExtendFeatureInput(core.Base):
     """
     This class defines the methods and properties that pertain to the definition of an extend feature.
@@ -26302,6 +26800,175 @@ class RemoveFeatures(core.Base):
         """
         return int()
 
+class RenderBatch(core.Base):
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    Renders many images of components or occurrences in the background, for instance to create catalogue images.
+    Use the Rendering.createRenderBatch method to create a batch, add the jobs with addJob and call start.
+    The scene settings and the environment of the design are set up once and shared by all jobs, and the images are
+    encoded and written by worker threads while the next jobs are rendered. Use the jobCompleted event to be notified
+    of each finished job instead of polling.
+    """
+    def __init__(self):
+        pass
+    @staticmethod
+    def cast(arg) -> RenderBatch:
+        return RenderBatch()
+    def addJob(self, target: core.Base, camera: core.Camera, width: int, height: int, filename: str) -> int:
+        """
+        Adds a job to the batch. Only the specified component or occurrence is visible in the image of the job.
+        target : The Component or Occurrence to render.
+        camera : The camera that defines the view of the image. If null, the camera of the active viewport is used.
+        width : The width of the image in pixels.
+        height : The height of the image in pixels.
+        filename : The full path and filename of the file to write the image to. The file extension can be .png, .jpg, .jpeg,
+        .tif, .tiff or .bmp and the file will be saved as that type.
+        Returns the index of the job or -1 if the job is invalid.
+        """
+        return int()
+    @property
+    def isThumbnail(self) -> bool:
+        """
+        Gets and sets whether the images are captured from the graphics like Component.createThumbnail instead of being ray traced
+        like Rendering.startLocalRender. Thumbnails are much faster, and renderQuality is ignored for them. Defaults to false.
+        """
+        return bool()
+    @isThumbnail.setter
+    def isThumbnail(self, value: bool):
+        """
+        Gets and sets whether the images are captured from the graphics like Component.createThumbnail instead of being ray traced
+        like Rendering.startLocalRender. Thumbnails are much faster, and renderQuality is ignored for them. Defaults to false.
+        """
+        pass
+    @property
+    def renderQuality(self) -> int:
+        """
+        Gets and sets the desired quality of the ray traced images, from 25 to 100 as for Rendering.renderQuality.
+        Defaults to the renderQuality of the Rendering the batch was created from.
+        """
+        return int()
+    @renderQuality.setter
+    def renderQuality(self, value: int):
+        """
+        Gets and sets the desired quality of the ray traced images, from 25 to 100 as for Rendering.renderQuality.
+        Defaults to the renderQuality of the Rendering the batch was created from.
+        """
+        pass
+    @property
+    def isBackgroundTransparent(self) -> bool:
+        """
+        Gets and sets whether the background of the images is transparent. Defaults to the isBackgroundTransparent of the
+        Rendering the batch was created from.
+        """
+        return bool()
+    @isBackgroundTransparent.setter
+    def isBackgroundTransparent(self, value: bool):
+        """
+        Gets and sets whether the background of the images is transparent. Defaults to the isBackgroundTransparent of the
+        Rendering the batch was created from.
+        """
+        pass
+    @property
+    def maxConcurrency(self) -> int:
+        """
+        Gets and sets the maximum number of images encoded and written at the same time. 0 uses the number of processor cores.
+        Defaults to 0.
+        """
+        return int()
+    @maxConcurrency.setter
+    def maxConcurrency(self, value: int):
+        """
+        Gets and sets the maximum number of images encoded and written at the same time. 0 uses the number of processor cores.
+        Defaults to 0.
+        """
+        pass
+    def start(self) -> bool:
+        """
+        Starts rendering the jobs in the background in the order they were added.
+        Returns true if the batch was started.
+        """
+        return bool()
+    def cancel(self) -> bool:
+        """
+        Cancels the jobs that are not finished yet. A cancelled job ends in the FailedLocalRenderState state with isCancelled
+        set to true and no error, and the jobCompleted event fires for it like for any other failed job.
+        Returns true if the jobs were cancelled.
+        """
+        return bool()
+    @property
+    def jobCompleted(self) -> RenderBatchJobEvent:
+        """
+        The jobCompleted event fires each time a job has finished: once its image file is written, when it failed or when it was
+        cancelled.
+        """
+        return RenderBatchJobEvent()
+    @property
+    def jobCount(self) -> int:
+        """
+        Returns the number of jobs in the batch.
+        """
+        return int()
+    @property
+    def numberOfCompleted(self) -> int:
+        """
+        Returns the number of jobs that are finished, including the failed ones.
+        """
+        return int()
+    @property
+    def isCompleted(self) -> bool:
+        """
+        Returns true if all jobs are finished.
+        """
+        return bool()
+    @property
+    def jobStates(self) -> list[int]:
+        """
+        Returns the state of each job. The values are obtained from the LocalRenderStates enum and returned as integers. Cancelled jobs report FailedLocalRenderState; use isCancelled to tell them from the jobs that failed. The array has one entry for each job, in the order the jobs were added.
+        """
+        return [int()]
+    @property
+    def isCancelled(self) -> list[bool]:
+        """
+        Returns whether each job was cancelled by the cancel method before it finished. The array has one entry for each job, in the order the jobs were added.
+        """
+        return [bool()]
+    @property
+    def errors(self) -> list[str]:
+        """
+        Returns the error message of each failed job, or an empty string for the jobs that succeeded, were cancelled or are not finished. The array has one entry for each job, in the order the jobs were added.
+        """
+        return [str()]
+    @property
+    def durations(self) -> list[float]:
+        """
+        Returns the time in seconds spent rendering and writing the image of each job, or 0 if the job is not finished. The array has one entry for each job, in the order the jobs were added.
+        """
+        return [float()]
+
+class RenderBatchJobEventHandler(core.EventHandler):
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    The RenderBatchJobEventHandler is a client implemented class that can be added as a handler to a
+    RenderBatchJobEvent.
+    """
+    def __init__(self):
+        pass
+    @staticmethod
+    def cast(arg) -> RenderBatchJobEventHandler:
+        return RenderBatchJobEventHandler()
+    def notify(self, eventArgs: RenderBatchJobEventArgs) -> None:
+        """
+        The function called by Fusion when the associated event is fired.
+        eventArgs : Returns an object that provides access to additional information associated with the event.
+        """
+        pass
+
 class RenderEnvironment(core.Base):
     """
     A render environment that is used when defining the scene for rendering. You see these
@@ -26576,6 +27243,16 @@ class Rendering(core.Base):
         The width must be between 108 and 4000 pixels.
         """
         pass
+    def createRenderBatch(self) -> RenderBatch:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Creates an empty batch to render many images of components or occurrences in the background with a shared scene setup.
+        Returns the newly created render batch.
+        """
+        return RenderBatch()
 
 class RenderManager(core.Base):
     """
@@ -36451,6 +37128,118 @@ class ArrangeDefinition3DInput(ArrangeDefinitionInput):
     @staticmethod
     def cast(arg) -> ArrangeDefinition3DInput:
         return ArrangeDefinition3DInput()
+    @property
+    def shapeType(self) -> Arrange3DShapeTypes:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Gets and sets how the shape of the parts is approximated. BoundingBoxArrange3DShapeType by default.
+        With VoxelArrange3DShapeType, the parts are tessellated and converted to voxels of size voxelSize, and the
+        objectSpacing of the envelope is kept between the voxels of different parts.
+        """
+        return Arrange3DShapeTypes()
+    @shapeType.setter
+    def shapeType(self, value: Arrange3DShapeTypes):
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Gets and sets how the shape of the parts is approximated. BoundingBoxArrange3DShapeType by default.
+        With VoxelArrange3DShapeType, the parts are tessellated and converted to voxels of size voxelSize, and the
+        objectSpacing of the envelope is kept between the voxels of different parts.
+        """
+        pass
+    @property
+    def voxelSize(self) -> core.ValueInput:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Gets and sets the edge length of the voxels used when shapeType is VoxelArrange3DShapeType.
+        Smaller voxels follow the shape of the parts more closely at the cost of memory and time.
+        If the ValueInput is created using a real number it is in centimeters. Defaults to 0.2 cm.
+        """
+        return core.ValueInput()
+    @voxelSize.setter
+    def voxelSize(self, value: core.ValueInput):
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Gets and sets the edge length of the voxels used when shapeType is VoxelArrange3DShapeType.
+        Smaller voxels follow the shape of the parts more closely at the cost of memory and time.
+        If the ValueInput is created using a real number it is in centimeters. Defaults to 0.2 cm.
+        """
+        pass
+    @property
+    def globalRotation(self) -> Arrange3DRotationTypes:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Gets and sets the rotations allowed for all parts. NoneArrange3DRotationType by default.
+        """
+        return Arrange3DRotationTypes()
+    @globalRotation.setter
+    def globalRotation(self, value: Arrange3DRotationTypes):
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Gets and sets the rotations allowed for all parts. NoneArrange3DRotationType by default.
+        """
+        pass
+    @property
+    def searchTimeLimit(self) -> float:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Gets and sets the time in seconds spent improving the arrangement after all parts have been placed.
+        0 disables the improvement. 0 by default.
+        """
+        return float()
+    @searchTimeLimit.setter
+    def searchTimeLimit(self, value: float):
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Gets and sets the time in seconds spent improving the arrangement after all parts have been placed.
+        0 disables the improvement. 0 by default.
+        """
+        pass
+    @property
+    def maxConcurrency(self) -> int:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Gets and sets the maximum number of threads used to compute the arrangement.
+        0 uses the number of processor cores. 0 by default.
+        """
+        return int()
+    @maxConcurrency.setter
+    def maxConcurrency(self, value: int):
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Gets and sets the maximum number of threads used to compute the arrangement.
+        0 uses the number of processor cores. 0 by default.
+        """
+        pass
 
 class ArrangeFeature(Feature):
     """
@@ -39179,6 +39968,64 @@ class ConfigurationAppearanceTable(ConfigurationTable):
         """
         return str()
 
+class ConfigurationBatchFuture(core.Future):
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    Used to check the state and get back the results of generating several rows of a configuration table with
+    ConfigurationRows.generateRows. The state of the future is finished once all rows are generated or skipped,
+    and failed if at least one row could not be generated.
+    """
+    def __init__(self):
+        pass
+    @staticmethod
+    def cast(arg) -> ConfigurationBatchFuture:
+        return ConfigurationBatchFuture()
+    @property
+    def rows(self) -> list[ConfigurationRow]:
+        """
+        Returns the rows that are generated.
+        """
+        return [ConfigurationRow()]
+    @property
+    def numberOfCompleted(self) -> int:
+        """
+        Returns the number of rows whose generation is complete, including the skipped and failed rows.
+        """
+        return int()
+    @property
+    def numberOfSkipped(self) -> int:
+        """
+        Returns the number of rows that were not generated because their cell values and the design have not changed since their last generation.
+        """
+        return int()
+    @property
+    def rowStates(self) -> list[int]:
+        """
+        Returns the state of the generation of each row. The values are obtained from the FutureStates enum and returned as integers. The array has one entry for each row, in the order of rows.
+        """
+        return [int()]
+    @property
+    def isSkipped(self) -> list[bool]:
+        """
+        Returns whether the generation of each row was skipped because its inputs have not changed. The array has one entry for each row, in the order of rows.
+        """
+        return [bool()]
+    @property
+    def errors(self) -> list[str]:
+        """
+        Returns the error message of each failed row, or an empty string if the row did not fail or is not complete yet. The array has one entry for each row, in the order of rows.
+        """
+        return [str()]
+    @property
+    def durations(self) -> list[float]:
+        """
+        Returns the time in seconds spent generating each row, or 0 if the row was skipped or is not complete yet. The array has one entry for each row, in the order of rows.
+        """
+        return [float()]
+
 class ConfigurationCustomThemeTable(ConfigurationTable):
     """
     API object representing a custom theme configuration table associated with a top table.
@@ -43537,6 +44384,63 @@ class EqualDistanceChamferEdgeSet(ChamferEdgeSet):
         """
         return ModelParameter()
 
+class ExportFuture(core.Future):
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    Used to check the state of an export started with ExportManager.executeAsync or added to an ExportQueue, and to cancel it.
+    The state of the future is finished once the file is completely written, and failed if the export failed or was cancelled.
+    """
+    def __init__(self):
+        pass
+    @staticmethod
+    def cast(arg) -> ExportFuture:
+        return ExportFuture()
+    @property
+    def exportOptions(self) -> ExportOptions:
+        """
+        Returns the export options of the export.
+        """
+        return ExportOptions()
+    @property
+    def progress(self) -> float:
+        """
+        Returns the progress of the export, from 0 to 1.
+        """
+        return float()
+    @property
+    def bytesWritten(self) -> int:
+        """
+        Returns the number of bytes written to the export file so far.
+        """
+        return int()
+    @property
+    def duration(self) -> float:
+        """
+        Returns the time in seconds spent on the export so far.
+        """
+        return float()
+    @property
+    def isCancelled(self) -> bool:
+        """
+        Returns true if the export was cancelled.
+        """
+        return bool()
+    @property
+    def error(self) -> str:
+        """
+        Returns the error message if the export failed, or an empty string otherwise.
+        """
+        return str()
+    def cancel(self) -> bool:
+        """
+        Cancels the export. A partially written file is deleted.
+        Returns true if the export was cancelled, or false if it is already finished.
+        """
+        return bool()
+
 class ExtendFeature(Feature):
     """
     Object that represents an existing extend feature in a design.
@@ -48578,6 +49482,91 @@ class RemoveFeature(Feature):
         """
         return RemoveFeature()
 
+class RenderBatchJobEvent(core.Event):
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    A RenderBatchJobEvent represents the completion of a single job of a RenderBatch.
+    It is used by the RenderBatch.jobCompleted event.
+    """
+    def __init__(self):
+        pass
+    @staticmethod
+    def cast(arg) -> RenderBatchJobEvent:
+        return RenderBatchJobEvent()
+    def add(self, handler: RenderBatchJobEventHandler) -> bool:
+        """
+        Add a handler to be notified when the event occurs.
+        handler : The handler object to be called when this event is fired.
+        Returns true if the addition of the handler was successful.
+        """
+        return bool()
+    def remove(self, handler: RenderBatchJobEventHandler) -> bool:
+        """
+        Removes a handler from the event.
+        handler : The handler object to be removed from the event.
+        Returns true if removal of the handler was successful.
+        """
+        return bool()
+
+class RenderBatchJobEventArgs(core.EventArgs):
+    """
+    !!!!! Warning !!!!!
+    ! This is in preview state; please see the help for more info
+    !!!!! Warning !!!!!
+    
+    The RenderBatchJobEventArgs provides information about a job of a RenderBatch that has finished.
+    """
+    def __init__(self):
+        pass
+    @staticmethod
+    def cast(arg) -> RenderBatchJobEventArgs:
+        return RenderBatchJobEventArgs()
+    @property
+    def renderBatch(self) -> RenderBatch:
+        """
+        Returns the render batch the job belongs to.
+        """
+        return RenderBatch()
+    @property
+    def jobIndex(self) -> int:
+        """
+        Returns the index of the job, in the order the jobs were added to the batch.
+        """
+        return int()
+    @property
+    def isSuccess(self) -> bool:
+        """
+        Returns true if the image of the job was written successfully.
+        """
+        return bool()
+    @property
+    def isCancelled(self) -> bool:
+        """
+        Returns true if the job was cancelled by RenderBatch.cancel before it finished. isSuccess is then false and error is empty.
+        """
+        return bool()
+    @property
+    def filename(self) -> str:
+        """
+        Returns the full path of the image file of the job.
+        """
+        return str()
+    @property
+    def error(self) -> str:
+        """
+        Returns the error message if the job failed, or an empty string if it succeeded or was cancelled.
+        """
+        return str()
+    @property
+    def numberOfCompleted(self) -> int:
+        """
+        Returns the number of jobs of the batch that are finished, including this one.
+        """
+        return int()
+
 class RenderEvent(core.Event):
     """
     A RenderEvent represents an event that occurs in reaction to the
@@ -52725,6 +53714,106 @@ class USDExportOptions(ExportOptions):
     @staticmethod
     def cast(arg) -> USDExportOptions:
         return USDExportOptions()
+    @property
+    def isIncremental(self) -> bool:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Gets and sets whether the export writes the stage as separate layers so that later exports only rewrite what changed.
+        When true, the file specified by filename is a root layer that references one layer per component, and the meshes
+        of the bodies of each component are written as payloads. The component layers are written into a folder named like
+        the file with "_layers" appended, next to the file. The revisionId of each component and the entityToken of each
+        occurrence are stored in a manifest, and the next incremental export to the same file only rewrites the layers of
+        the components whose revisionId changed and the transforms of the occurrences that moved. Layers of deleted
+        components are removed. Defaults to false.
+        """
+        return bool()
+    @isIncremental.setter
+    def isIncremental(self, value: bool):
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Gets and sets whether the export writes the stage as separate layers so that later exports only rewrite what changed.
+        When true, the file specified by filename is a root layer that references one layer per component, and the meshes
+        of the bodies of each component are written as payloads. The component layers are written into a folder named like
+        the file with "_layers" appended, next to the file. The revisionId of each component and the entityToken of each
+        occurrence are stored in a manifest, and the next incremental export to the same file only rewrites the layers of
+        the components whose revisionId changed and the transforms of the occurrences that moved. Layers of deleted
+        components are removed. Defaults to false.
+        """
+        pass
+    @property
+    def manifestFilename(self) -> str:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Gets and sets the full path of the manifest used by incremental exports. If the manifest does not exist or does not
+        match the exported design, all layers are written. An empty string, which is the default, uses a file named like
+        the exported file with ".manifest.json" appended.
+        """
+        return str()
+    @manifestFilename.setter
+    def manifestFilename(self, value: str):
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Gets and sets the full path of the manifest used by incremental exports. If the manifest does not exist or does not
+        match the exported design, all layers are written. An empty string, which is the default, uses a file named like
+        the exported file with ".manifest.json" appended.
+        """
+        pass
+    @property
+    def isInstancing(self) -> bool:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Gets and sets whether the occurrences of a component that is used several times are written as instances of a single
+        prototype instead of repeating its meshes. Defaults to true.
+        """
+        return bool()
+    @isInstancing.setter
+    def isInstancing(self, value: bool):
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Gets and sets whether the occurrences of a component that is used several times are written as instances of a single
+        prototype instead of repeating its meshes. Defaults to true.
+        """
+        pass
+    @property
+    def isUsingDoublePrecisionPoints(self) -> bool:
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Gets and sets whether the points of the meshes are written with double precision. Single precision points, which
+        are the default, halve the size of the meshes and are sufficient for visualization.
+        """
+        return bool()
+    @isUsingDoublePrecisionPoints.setter
+    def isUsingDoublePrecisionPoints(self, value: bool):
+        """
+        !!!!! Warning !!!!!
+        ! This is in preview state; please see the help for more info
+        !!!!! Warning !!!!!
+        
+        Gets and sets whether the points of the meshes are written with double precision. Single precision points, which
+        are the default, halve the size of the meshes and are sufficient for visualization.
+        """
+        pass
 
 class UserParameter(Parameter):
     """